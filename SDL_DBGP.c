@@ -1,280 +1,5887 @@
 #include <stdarg.h>
 #include "SDL_DBGP.h"
+#if DBGP_USE_LIBC_MEMCHR
+#include <string.h>
+#endif
 
-#define GLYPHS_PER_LINE (256 / 8)
 #define GLYPH_WIDTH 8
 
+static void* SDLCALL default_malloc(void* userdata, size_t size) {
+  (void) userdata;
+  return SDL_malloc(size);
+}
+
+static void* SDLCALL default_realloc(void* userdata, void* mem, size_t size) {
+  (void) userdata;
+  return SDL_realloc(mem, size);
+}
+
+static void SDLCALL default_free(void* userdata, void* mem) {
+  (void) userdata;
+  SDL_free(mem);
+}
+
+static DBGP_MallocFunc malloc_func = default_malloc;
+static DBGP_ReallocFunc realloc_func = default_realloc;
+static DBGP_FreeFunc free_func = default_free;
+static void* allocator_userdata = NULL;
+
+static inline void* mem_malloc(size_t size) {
+  void* mem = malloc_func(allocator_userdata, size);
+  if (mem == NULL) {
+    SDL_OutOfMemory();
+  }
+  return mem;
+}
+
+static inline void* mem_calloc(size_t nb, size_t size) {
+  if (size != 0 && nb > SDL_SIZE_MAX / size) {
+    SDL_OutOfMemory();
+    return NULL;
+  }
+  void* mem = mem_malloc(nb * size);
+  if (mem != NULL) {
+    SDL_memset(mem, 0, nb * size);
+  }
+  return mem;
+}
+
+static inline void* mem_realloc(void* mem, size_t size) {
+  void* new_mem = realloc_func(allocator_userdata, mem, size);
+  if (new_mem == NULL) {
+    SDL_OutOfMemory();
+  }
+  return new_mem;
+}
+
+static inline void mem_free(void* mem) {
+  if (mem != NULL) {
+    free_func(allocator_userdata, mem);
+  }
+}
+
+// The frame arena is a list of chunks of scratch memory, used as a stack:
+// allocations are released by going back to a previous mark. Chunks are kept
+// between frames, so that no memory is allocated in steady state.
+typedef struct arena_chunk {
+  struct arena_chunk* next;
+  size_t size;
+  size_t used;
+} arena_chunk;
+
+typedef struct {
+  arena_chunk* chunk;
+  size_t used;
+} arena_mark;
+
+#define ARENA_ALIGN(size) (((size) + 15) & ~(size_t) 15)
+#define ARENA_HEADER_SIZE ARENA_ALIGN(sizeof(arena_chunk))
+
+static arena_chunk* arena_first = NULL;
+static arena_chunk* arena_current = NULL;
+
+static void* arena_alloc(size_t size) {
+  size = ARENA_ALIGN(size);
+  arena_chunk* chunk = arena_current;
+  while (chunk != NULL && chunk->used + size > chunk->size) {
+    // the following chunks only hold released allocations
+    chunk = chunk->next;
+    if (chunk != NULL) {
+      chunk->used = 0;
+    }
+  }
+
+  if (chunk == NULL) {
+    const size_t chunk_size = SDL_max(size, DBGP_FRAME_ARENA_SIZE);
+    chunk = mem_malloc(ARENA_HEADER_SIZE + chunk_size);
+    if (chunk == NULL) {
+      return NULL;
+    }
+    chunk->next = NULL;
+    chunk->size = chunk_size;
+    chunk->used = 0;
+    if (arena_first == NULL) {
+      arena_first = chunk;
+    } else {
+      arena_chunk* last = arena_current;
+      while (last->next != NULL) {
+        last = last->next;
+      }
+      last->next = chunk;
+    }
+  }
+
+  arena_current = chunk;
+  void* mem = (Uint8*) chunk + ARENA_HEADER_SIZE + chunk->used;
+  chunk->used += size;
+  return mem;
+}
+
+static inline arena_mark get_arena_mark(void) {
+  arena_mark mark = {arena_current, arena_current ? arena_current->used : 0};
+  return mark;
+}
+
+static inline void release_arena(arena_mark mark) {
+  arena_current = mark.chunk != NULL ? mark.chunk : arena_first;
+  if (arena_current != NULL) {
+    arena_current->used = mark.chunk != NULL ? mark.used : 0;
+  }
+}
+
+// Whether a batch opened by DBGP_BeginBatch holds vertices in the arena.
+static bool is_batch_open(void);
+
+static void free_arena(void) {
+  while (arena_first != NULL) {
+    arena_chunk* next = arena_first->next;
+    mem_free(arena_first);
+    arena_first = next;
+  }
+  arena_current = NULL;
+}
+
+void DBGP_ResetFrameArena(void) {
+  if (is_batch_open()) {
+    return;
+  }
+  if (arena_first != NULL && arena_first->next != NULL) {
+    // several chunks were needed: replace them by a single one, large enough
+    // for the next frames
+    size_t size = 0;
+    for (arena_chunk* chunk = arena_first; chunk != NULL; chunk = chunk->next) {
+      size += chunk->size;
+    }
+    free_arena();
+    arena_first = mem_malloc(ARENA_HEADER_SIZE + size);
+    if (arena_first != NULL) {
+      arena_first->next = NULL;
+      arena_first->size = size;
+    }
+  }
+  arena_current = arena_first;
+  if (arena_current != NULL) {
+    arena_current->used = 0;
+  }
+}
+
+bool DBGP_SetAllocator(
+    DBGP_MallocFunc malloc_fn, DBGP_ReallocFunc realloc_fn,
+    DBGP_FreeFunc free_fn, void* userdata) {
+  if (malloc_fn == NULL && realloc_fn == NULL && free_fn == NULL) {
+    malloc_fn = default_malloc;
+    realloc_fn = default_realloc;
+    free_fn = default_free;
+    userdata = NULL;
+  } else if (malloc_fn == NULL || realloc_fn == NULL || free_fn == NULL) {
+    return SDL_SetError("All allocator functions must be set");
+  }
+
+  if (is_batch_open()) {
+    return SDL_SetError("Can't set the allocator while a batch is open");
+  }
+  // the arena was allocated with the previous functions
+  free_arena();
+  malloc_func = malloc_fn;
+  realloc_func = realloc_fn;
+  free_func = free_fn;
+  allocator_userdata = userdata;
+  return true;
+}
+
+// Formats a string into the frame arena (up to DBGP_MAX_STR_LEN bytes,
+// NULL character included).
+static char* format_string(const char* fmt, va_list args) {
+  va_list args_copy;
+  va_copy(args_copy, args);
+  const int len = SDL_vsnprintf(NULL, 0, fmt, args_copy);
+  va_end(args_copy);
+  if (len < 0) {
+    return NULL;
+  }
+  const size_t size = SDL_min((size_t) len + 1, (size_t) DBGP_MAX_STR_LEN);
+  char* str = arena_alloc(size);
+  if (str != NULL) {
+    SDL_vsnprintf(str, size, fmt, args);
+  }
+  return str;
+}
+
+// texture formats with an alpha channel, from the smallest to the largest
+static const SDL_PixelFormat atlas_formats[] = {
+    SDL_PIXELFORMAT_ARGB4444, SDL_PIXELFORMAT_ABGR4444,
+    SDL_PIXELFORMAT_RGBA4444, SDL_PIXELFORMAT_BGRA4444,
+    SDL_PIXELFORMAT_ARGB1555, SDL_PIXELFORMAT_ABGR1555,
+    SDL_PIXELFORMAT_RGBA5551, SDL_PIXELFORMAT_BGRA5551,
+    SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_ABGR8888,
+    SDL_PIXELFORMAT_RGBA8888, SDL_PIXELFORMAT_BGRA8888,
+};
+
+static SDL_PixelFormat get_atlas_format(SDL_PropertiesID props) {
+  const SDL_PixelFormat* supported = SDL_GetPointerProperty(
+      props, SDL_PROP_RENDERER_TEXTURE_FORMATS_POINTER, NULL);
+  if (supported == NULL) {
+    return SDL_PIXELFORMAT_ARGB8888;
+  }
+  for (size_t i = 0; i < SDL_arraysize(atlas_formats); i++) {
+    for (const SDL_PixelFormat* f = supported; *f != SDL_PIXELFORMAT_UNKNOWN;
+         f++) {
+      if (*f == atlas_formats[i]) {
+        return *f;
+      }
+    }
+  }
+  return SDL_PIXELFORMAT_ARGB8888;
+}
+
+// The renderer properties an atlas is laid out for. They are read on the
+// render thread, before atlases are prepared on any thread.
+typedef struct {
+  int max_size; // the maximum texture size
+  SDL_PixelFormat format; // the texture format of the atlas
+} atlas_target;
+
+static void get_atlas_target(SDL_Renderer* renderer, atlas_target* target) {
+  const SDL_PropertiesID props = SDL_GetRendererProperties(renderer);
+  target->max_size = (int) SDL_GetNumberProperty(
+      props, SDL_PROP_RENDERER_MAX_TEXTURE_SIZE_NUMBER, 2048);
+  target->format = get_atlas_format(props);
+}
+
+// Returns the number of columns of the grid with the least padding whose sides
+// are smaller than limit, or 0 if there is none.
+static int find_atlas_grid(
+    int nb_glyphs, int glyph_width, int glyph_height, int max_cols, int limit) {
+  int best_cols = 0;
+  int best_padding = 0;
+  int best_longest = 0;
+  for (int cols = 1; cols <= SDL_min(max_cols, nb_glyphs); cols++) {
+    const int rows = (nb_glyphs + cols - 1) / cols;
+    const int w = cols * glyph_width;
+    const int h = rows * glyph_height;
+    if (w > limit || h > limit) {
+      continue;
+    }
+    const int padding = cols * rows - nb_glyphs;
+    const int longest = SDL_max(w, h);
+    if (best_cols == 0 || padding < best_padding ||
+        (padding == best_padding && longest < best_longest)) {
+      best_cols = cols;
+      best_padding = padding;
+      best_longest = longest;
+    }
+  }
+  return best_cols;
+}
+
+// Picks the atlas grid: glyphs are split evenly between the minimum number of
+// pages, then each page uses the grid with the least padding whose sides stay
+// within twice the side of a square page (if possible).
+static bool layout_atlas(
+    DBGP_FontAtlas* atlas, unsigned int nb_glyphs, int glyph_width,
+    int glyph_height, int max_size) {
+  const int max_cols = max_size / glyph_width;
+  const int max_rows = max_size / glyph_height;
+  if (max_cols == 0 || max_rows == 0) {
+    return SDL_SetError("Glyphs don't fit in a %dpx texture", max_size);
+  }
+
+  const Uint64 max_per_page = (Uint64) max_cols * max_rows;
+  const Uint64 nb_pages = (nb_glyphs + max_per_page - 1) / max_per_page;
+  if (nb_pages > DBGP_MAX_ATLAS_PAGES) {
+    return SDL_SetError(
+        "Font needs %d textures of %dpx (max %d)", (int) nb_pages, max_size,
+        DBGP_MAX_ATLAS_PAGES);
+  }
+  const int per_page = (int) ((nb_glyphs + nb_pages - 1) / nb_pages);
+
+  int side = 1;
+  const Uint64 area = (Uint64) per_page * glyph_width * glyph_height;
+  while ((Uint64) side * side < area) {
+    side *= 2;
+  }
+
+  int best_cols = find_atlas_grid(
+      per_page, glyph_width, glyph_height, max_cols,
+      SDL_min(side * 2, max_size));
+  if (best_cols == 0) {
+    best_cols = find_atlas_grid(
+        per_page, glyph_width, glyph_height, max_cols, max_size);
+  }
+  if (best_cols == 0) {
+    return SDL_SetError("Unable to lay out font atlas");
+  }
+
+  atlas->glyphs_per_line = best_cols;
+  atlas->glyphs_per_page = per_page;
+  atlas->cell_width = glyph_width;
+  atlas->cell_height = glyph_height;
+  atlas->nb_pages = (int) nb_pages;
+  atlas->width = best_cols * glyph_width;
+  atlas->height = (per_page + best_cols - 1) / best_cols * glyph_height;
+  return true;
+}
+
+// Draws glyphs into a surface in the atlas format.
+static SDL_Surface* create_atlas_surface(
+    const DBGP_Font* font, const DBGP_FontAtlas* atlas,
+    unsigned int first_glyph, unsigned int nb_glyphs) {
+  SDL_Surface* surface =
+      SDL_CreateSurface(atlas->width, atlas->height, SDL_PIXELFORMAT_INDEX1MSB);
+  if (!surface) {
+    return NULL;
+  }
+  SDL_Palette* palette = SDL_CreatePalette(2);
+  if (!palette) {
+    SDL_DestroySurface(surface);
+    return NULL;
+  }
+  SDL_Color colors[2] = {{0, 0, 0, 0}, {255, 255, 255, 255}};
+  SDL_Surface* converted = NULL;
+  if (!SDL_SetPaletteColors(palette, colors, 0, 2) ||
+      !SDL_SetSurfacePalette(surface, palette)) {
+    goto done;
+  }
+
+  // glyphs are 8px wide and MSB first: each row of a glyph is one byte of the
+  // surface
+  for (unsigned int i = 0; i < nb_glyphs; i++) {
+    const unsigned char* glyph =
+        &font->raw_data[(size_t) (first_glyph + i) * font->glyph_height];
+    Uint8* dst = (Uint8*) surface->pixels +
+                 i / atlas->glyphs_per_line * font->glyph_height *
+                     surface->pitch +
+                 i % atlas->glyphs_per_line;
+    for (int row = 0; row < font->glyph_height; row++) {
+      *dst = glyph[row];
+      dst += surface->pitch;
+    }
+  }
+
+  converted = SDL_ConvertSurface(surface, atlas->format);
+
+done:
+  SDL_DestroySurface(surface);
+  SDL_DestroyPalette(palette);
+  return converted;
+}
+
+// Returns row of a glyph bitmap in the 16 bits most significant bit first,
+// or 0 outside the glyph.
+static inline Uint16 get_glyph_row(
+    const DBGP_Font* font, const unsigned char* glyph, int row) {
+  return row >= 0 && row < font->glyph_height ? (Uint16) (glyph[row] << 8)
+                                              : 0;
+}
+
+// Draws glyphs with the effect of a style into a surface in the atlas format:
+// glyph pixels are white, and shadow or outline pixels black, so that the
+// vertex color only tints the glyph.
+static SDL_Surface* create_style_surface(
+    const DBGP_Font* font, const DBGP_FontAtlas* atlas, int style,
+    unsigned int first_glyph, unsigned int nb_glyphs) {
+  SDL_Surface* surface = SDL_CreateSurface(
+      atlas->width, atlas->height, SDL_PIXELFORMAT_ARGB8888);
+  if (!surface) {
+    return NULL;
+  }
+
+  for (unsigned int i = 0; i < nb_glyphs; i++) {
+    const unsigned char* glyph =
+        &font->raw_data[(size_t) (first_glyph + i) * font->glyph_height];
+    const int x = i % atlas->glyphs_per_line * atlas->cell_width;
+    const int y = i / atlas->glyphs_per_line * atlas->cell_height;
+    for (int row = 0; row < atlas->cell_height; row++) {
+      const int glyph_row = row - atlas->glyph_y;
+      Uint16 fill = get_glyph_row(font, glyph, glyph_row) >> atlas->glyph_x;
+      Uint16 effect = 0;
+      switch (style) {
+      case DBGP_STYLE_SHADOW:
+        effect = get_glyph_row(font, glyph, glyph_row - 1) >> 1;
+        break;
+      case DBGP_STYLE_OUTLINE:
+        for (int dy = -1; dy <= 1; dy++) {
+          const Uint16 bits =
+              get_glyph_row(font, glyph, glyph_row + dy) >> atlas->glyph_x;
+          effect |= (Uint16) (bits << 1) | bits | bits >> 1;
+        }
+        break;
+      case DBGP_STYLE_BOLD: fill |= fill >> 1; break;
+      }
+      effect &= ~fill;
+
+      Uint32* dst =
+          (Uint32*) ((Uint8*) surface->pixels + (y + row) * surface->pitch) +
+          x;
+      for (int col = 0; col < atlas->cell_width; col++) {
+        const Uint16 bit = 0x8000 >> col;
+        dst[col] = (fill & bit)     ? 0xffffffff
+                   : (effect & bit) ? 0xff000000
+                                    : 0;
+      }
+    }
+  }
+
+  SDL_Surface* converted = SDL_ConvertSurface(surface, atlas->format);
+  SDL_DestroySurface(surface);
+  return converted;
+}
+
+// Lays out an atlas (plain or styled) of a font whose bitmaps are loaded,
+// and draws its pages into surfaces. The renderer isn't used, so this can run
+// on any thread.
+static bool prepare_atlas(
+    DBGP_Font* font, DBGP_FontAtlas* atlas, const atlas_target* target,
+    int style) {
+  // shadows and bold glyphs extend 1px right (and down), outlines 1px around
+  const int margin = style == DBGP_STYLE_OUTLINE ? 2 : style != 0 ? 1 : 0;
+  if (!layout_atlas(
+          atlas, font->nb_glyphs, font->glyph_width + margin,
+          font->glyph_height + (style == DBGP_STYLE_BOLD ? 0 : margin),
+          target->max_size)) {
+    return false;
+  }
+  atlas->glyph_x = atlas->glyph_y = style == DBGP_STYLE_OUTLINE ? 1 : 0;
+  atlas->format = target->format;
+
+  for (int page = 0; page < atlas->nb_pages; page++) {
+    unsigned int first = page * atlas->glyphs_per_page;
+    unsigned int count =
+        SDL_min(font->nb_glyphs - first, (unsigned int) atlas->glyphs_per_page);
+    atlas->surfaces[page] =
+        style == DBGP_STYLE_PLAIN
+            ? create_atlas_surface(font, atlas, first, count)
+            : create_style_surface(font, atlas, style, first, count);
+    if (atlas->surfaces[page] == NULL) {
+      return false;
+    }
+  }
+
+  return true;
+}
+
+static inline bool prepare_font_atlas(
+    DBGP_Font* font, const atlas_target* target) {
+  return prepare_atlas(font, &font->atlas, target, DBGP_STYLE_PLAIN);
+}
+
+// Creates the textures of prepared atlas pages, on the render thread.
+static bool upload_atlas(DBGP_FontAtlas* atlas, SDL_Renderer* renderer) {
+  for (int page = 0; page < atlas->nb_pages; page++) {
+    SDL_Surface* surface = atlas->surfaces[page];
+    if (surface == NULL) {
+      continue;
+    }
+    SDL_Texture* tex = SDL_CreateTexture(
+        renderer, atlas->format, SDL_TEXTUREACCESS_STATIC, atlas->width,
+        atlas->height);
+    if (tex == NULL) {
+      return false;
+    }
+    atlas->pages[page] = tex;
+    if (!SDL_UpdateTexture(tex, NULL, surface->pixels, surface->pitch)) {
+      return false;
+    }
+    if (!SDL_SetTextureScaleMode(tex, SDL_SCALEMODE_NEAREST)) {
+      SDL_Log("Error while setting scale mode: %s", SDL_GetError());
+    }
+    if (!SDL_SetTextureBlendMode(tex, SDL_BLENDMODE_BLEND)) {
+      SDL_Log("Error while setting blend mode: %s", SDL_GetError());
+    }
+    SDL_DestroySurface(surface);
+    atlas->surfaces[page] = NULL;
+  }
+
+  return true;
+}
+
+static bool upload_font_atlas(DBGP_Font* font, SDL_Renderer* renderer) {
+  if (!upload_atlas(&font->atlas, renderer)) {
+    return false;
+  }
+  font->tex = font->atlas.pages[0];
+  return true;
+}
+
+// Creates the atlas textures of a font whose bitmaps are loaded.
+static bool create_font_textures(DBGP_Font* font, SDL_Renderer* renderer) {
+  atlas_target target;
+  get_atlas_target(renderer, &target);
+  return prepare_font_atlas(font, &target) &&
+         upload_font_atlas(font, renderer);
+}
+
+// Compressed font data (as generated by unscii2raw.py) starts with:
+// "DBGZ", a version byte, the glyph height, two zero bytes and the number of
+// glyphs (32-bit little-endian). Tokens follow: 0x00-0x7F is a run of
+// (token + 1) literal bytes, 0x80-0xFF copies ((token & 0x7F) + 3) bytes
+// from a 16-bit little-endian distance back in the output (overlapping
+// copies repeat bytes).
+#define COMPRESSED_HEADER_SIZE 12
+#define COMPRESSED_VERSION 1
+
+static inline bool is_compressed(const unsigned char* data, size_t len) {
+  return len >= COMPRESSED_HEADER_SIZE && data[0] == 'D' && data[1] == 'B' &&
+         data[2] == 'G' && data[3] == 'Z';
+}
+
+// Decompresses the tokens of compressed font data in one pass.
+static bool decompress_font(
+    const unsigned char* src, size_t src_len, unsigned char* dst,
+    size_t dst_len) {
+  const unsigned char* const src_end = src + src_len;
+  size_t pos = 0;
+  while (pos < dst_len) {
+    if (src == src_end) {
+      return SDL_SetError("Truncated compressed font");
+    }
+    const unsigned int token = *src++;
+    if (token < 0x80) {
+      const size_t len = token + 1;
+      if (len > (size_t) (src_end - src) || len > dst_len - pos) {
+        return SDL_SetError("Invalid compressed font");
+      }
+      SDL_memcpy(&dst[pos], src, len);
+      src += len;
+      pos += len;
+    } else {
+      if (src_end - src < 2) {
+        return SDL_SetError("Truncated compressed font");
+      }
+      const size_t len = (token & 0x7f) + 3;
+      const size_t distance = src[0] | src[1] << 8;
+      src += 2;
+      if (distance == 0 || distance > pos || len > dst_len - pos) {
+        return SDL_SetError("Invalid compressed font");
+      }
+      const unsigned char* from = &dst[pos - distance];
+      for (size_t i = 0; i < len; i++) {
+        dst[pos + i] = from[i];
+      }
+      pos += len;
+    }
+  }
+  return true;
+}
+
+static void free_atlas(DBGP_FontAtlas* atlas) {
+  for (int page = 0; page < atlas->nb_pages; page++) {
+    if (atlas->pages[page] != NULL && !atlas->shared) {
+      SDL_DestroyTexture(atlas->pages[page]);
+    }
+    SDL_DestroySurface(atlas->surfaces[page]);
+  }
+  SDL_memset(atlas, 0, sizeof(*atlas));
+}
+
+// Frees everything a font owns, without waiting for its preparation.
+static void free_font(DBGP_Font* font) {
+  free_atlas(&font->atlas);
+  for (int i = 0; i < DBGP_NB_STYLES; i++) {
+    free_atlas(&font->style_atlases[i]);
+  }
+  font->style = DBGP_STYLE_PLAIN;
+  mem_free(font->raw_data);
+  font->raw_data = NULL;
+  mem_free(font->codepoints);
+  font->codepoints = NULL;
+  mem_free(font->codepoint_glyphs);
+  font->codepoint_glyphs = NULL;
+  font->nb_codepoints = 0;
+  mem_free(font->wide_glyphs);
+  font->wide_glyphs = NULL;
+  mem_free(font->fallbacks);
+  font->fallbacks = NULL;
+  font->nb_fallbacks = 0;
+  mem_free(font->fallback_cache);
+  font->fallback_cache = NULL;
+  font->tex = NULL;
+  font->glyph_width = 0;
+  font->glyph_height = 0;
+  font->nb_glyphs = 0;
+}
+
+// Loads the bitmaps of a zeroed font, and prepares its atlas if target isn't
+// NULL.
+static bool prepare_font(
+    DBGP_Font* font, const atlas_target* target,
+    const unsigned char* const raw_data, size_t raw_data_len,
+    Uint8 glyph_height) {
+  font->glyph_width = GLYPH_WIDTH;
+  font->glyph_height = glyph_height;
+
+  const bool compressed = is_compressed(raw_data, raw_data_len);
+  if (compressed) {
+    if (raw_data[4] != COMPRESSED_VERSION) {
+      return SDL_SetError("Unsupported compressed font version");
+    }
+    if (raw_data[5] != glyph_height) {
+      return SDL_SetError(
+          "Compressed font glyph height is %d, not %d", raw_data[5],
+          glyph_height);
+    }
+    font->nb_glyphs = (Uint32) raw_data[8] | (Uint32) raw_data[9] << 8 |
+                      (Uint32) raw_data[10] << 16 |
+                      (Uint32) raw_data[11] << 24;
+  } else {
+    font->nb_glyphs = raw_data_len / font->glyph_height;
+  }
+  if (font->nb_glyphs == 0) {
+    return SDL_SetError("Font has no glyph");
+  }
+
+  const size_t data_len = (size_t) font->nb_glyphs * font->glyph_height;
+  font->raw_data = mem_malloc(data_len);
+  if (font->raw_data == NULL) {
+    return false;
+  }
+  if (!compressed) {
+    SDL_memcpy(font->raw_data, raw_data, data_len);
+  } else if (!decompress_font(
+                 raw_data + COMPRESSED_HEADER_SIZE,
+                 raw_data_len - COMPRESSED_HEADER_SIZE, font->raw_data,
+                 data_len)) {
+    free_font(font);
+    return false;
+  }
+  if (target == NULL) {
+    // no atlas: the font can only be used with the *ToSurface functions
+    return true;
+  }
+
+  if (!prepare_font_atlas(font, target)) {
+    free_font(font);
+    return false;
+  }
+
+  return true;
+}
+
+enum {
+  PREPARE_DONE, // prepared synchronously, or uploaded
+  PREPARE_RUNNING,
+  PREPARE_SUCCEEDED,
+  PREPARE_FAILED,
+};
+
+bool DBGP_PrepareFont(
+    DBGP_Font* font, SDL_Renderer* renderer,
+    const unsigned char* const raw_data, size_t raw_data_len,
+    Uint8 glyph_height) {
+  if (font == NULL || raw_data == NULL || glyph_height == 0) {
+    return false;
+  }
+  SDL_memset(font, 0, sizeof(*font));
+  atlas_target target;
+  if (renderer != NULL) {
+    get_atlas_target(renderer, &target);
+  }
+  return prepare_font(
+      font, renderer != NULL ? &target : NULL, raw_data, raw_data_len,
+      glyph_height);
+}
+
+// Arguments of an asynchronous preparation
+typedef struct {
+  DBGP_Font* font;
+  atlas_target target;
+  bool has_target; // false without a renderer
+  const unsigned char* raw_data;
+  size_t raw_data_len;
+  Uint8 glyph_height;
+} prepare_args;
+
+static int SDLCALL prepare_font_thread(void* data) {
+  prepare_args* args = data;
+  const bool result = prepare_font(
+      args->font, args->has_target ? &args->target : NULL, args->raw_data,
+      args->raw_data_len, args->glyph_height);
+  if (!result) {
+    // errors are per thread: log it before DBGP_UploadFont reports a failure
+    SDL_Log("Unable to prepare font: %s", SDL_GetError());
+  }
+  SDL_SetAtomicInt(
+      &args->font->prepare_state,
+      result ? PREPARE_SUCCEEDED : PREPARE_FAILED);
+  mem_free(args);
+  return 0;
+}
+
+bool DBGP_PrepareFontAsync(
+    DBGP_Font* font, SDL_Renderer* renderer,
+    const unsigned char* const raw_data, size_t raw_data_len,
+    Uint8 glyph_height) {
+  if (font == NULL || raw_data == NULL || glyph_height == 0) {
+    return false;
+  }
+  SDL_memset(font, 0, sizeof(*font));
+
+  prepare_args* args = mem_malloc(sizeof(prepare_args));
+  if (args == NULL) {
+    return false;
+  }
+  args->font = font;
+  // renderer properties can't be read from the preparation thread
+  args->has_target = renderer != NULL;
+  if (renderer != NULL) {
+    get_atlas_target(renderer, &args->target);
+  }
+  args->raw_data = raw_data;
+  args->raw_data_len = raw_data_len;
+  args->glyph_height = glyph_height;
+
+  SDL_SetAtomicInt(&font->prepare_state, PREPARE_RUNNING);
+  font->prepare_thread =
+      SDL_CreateThread(prepare_font_thread, "DBGP_PrepareFont", args);
+  if (font->prepare_thread == NULL) {
+    SDL_SetAtomicInt(&font->prepare_state, PREPARE_DONE);
+    mem_free(args);
+    return false;
+  }
+  return true;
+}
+
+bool DBGP_IsFontPrepared(DBGP_Font* font) {
+  return font != NULL &&
+         SDL_GetAtomicInt(&font->prepare_state) != PREPARE_RUNNING;
+}
+
+// Waits for the asynchronous preparation of a font, returning false if it
+// failed.
+static bool wait_font_preparation(DBGP_Font* font) {
+  if (font->prepare_thread == NULL) {
+    return true;
+  }
+  SDL_WaitThread(font->prepare_thread, NULL);
+  font->prepare_thread = NULL;
+  const int state = SDL_GetAtomicInt(&font->prepare_state);
+  SDL_SetAtomicInt(&font->prepare_state, PREPARE_DONE);
+  return state == PREPARE_SUCCEEDED;
+}
+
+bool DBGP_UploadFont(DBGP_Font* font, SDL_Renderer* renderer) {
+  if (font == NULL) {
+    return false;
+  }
+  if (!wait_font_preparation(font)) {
+    free_font(font);
+    return SDL_SetError("Font preparation failed");
+  }
+  if (font->raw_data == NULL) {
+    return SDL_SetError("Font is not prepared");
+  }
+  if (renderer == NULL) {
+    return true;
+  }
+
+  atlas_target target;
+  get_atlas_target(renderer, &target);
+  if ((font->atlas.nb_pages == 0 && !prepare_font_atlas(font, &target)) ||
+      !upload_font_atlas(font, renderer)) {
+    free_font(font);
+    return false;
+  }
+  return true;
+}
+
 bool DBGP_CreateFont(
     DBGP_Font* font, SDL_Renderer* renderer,
     const unsigned char* const raw_data, size_t raw_data_len,
     Uint8 glyph_height) {
+  return DBGP_PrepareFont(
+             font, renderer, raw_data, raw_data_len, glyph_height) &&
+         DBGP_UploadFont(font, renderer);
+}
+
+void DBGP_DestroyFont(DBGP_Font* font) {
+  if (font == NULL) {
+    return;
+  }
+  wait_font_preparation(font);
+  free_font(font);
+}
+
+bool DBGP_GetFontMemoryUsage(
+    const DBGP_Font* font, size_t* gpu_bytes, size_t* cpu_bytes) {
   if (font == NULL) {
     return false;
   }
+  if (gpu_bytes) {
+    *gpu_bytes = 0;
+    for (int i = -1; i < DBGP_NB_STYLES; i++) {
+      const DBGP_FontAtlas* atlas =
+          i < 0 ? &font->atlas : &font->style_atlases[i];
+      if (!atlas->shared) {
+        *gpu_bytes += (size_t) atlas->nb_pages * atlas->width *
+                      atlas->height * SDL_BYTESPERPIXEL(atlas->format);
+      }
+    }
+  }
+  if (cpu_bytes) {
+    *cpu_bytes = sizeof(*font);
+    if (font->raw_data != NULL) {
+      *cpu_bytes += (size_t) font->nb_glyphs * font->glyph_height;
+    }
+    if (font->codepoints != NULL) {
+      *cpu_bytes += font->nb_codepoints * 2 * sizeof(Uint32);
+    }
+    if (font->wide_glyphs != NULL) {
+      *cpu_bytes += (font->nb_glyphs + 7) / 8;
+    }
+    if (font->fallbacks != NULL) {
+      *cpu_bytes += font->nb_fallbacks * sizeof(DBGP_Font*) +
+                    DBGP_FALLBACK_CACHE_SIZE * sizeof(Uint64);
+    }
+  }
+  return true;
+}
+
+#define ALL_STYLES (DBGP_STYLE_SHADOW | DBGP_STYLE_OUTLINE | DBGP_STYLE_BOLD)
+
+// Returns the index in DBGP_Font.style_atlases of a style other than plain.
+static inline int get_style_index(int style) {
+  return SDL_MostSignificantBitIndex32(style);
+}
+
+bool DBGP_CreateFontStyles(
+    DBGP_Font* font, SDL_Renderer* renderer, int styles) {
+  if (font == NULL || font->tex == NULL || renderer == NULL) {
+    return false;
+  }
+  if ((styles & ~ALL_STYLES) != 0) {
+    return SDL_SetError("Invalid font styles 0x%x", styles);
+  }
+  atlas_target target;
+  get_atlas_target(renderer, &target);
+  for (int i = 0; i < DBGP_NB_STYLES; i++) {
+    DBGP_FontAtlas* atlas = &font->style_atlases[i];
+    if ((styles & 1 << i) == 0 || atlas->nb_pages > 0) {
+      continue;
+    }
+    if (!prepare_atlas(font, atlas, &target, 1 << i) ||
+        !upload_atlas(atlas, renderer)) {
+      free_atlas(atlas);
+      return false;
+    }
+  }
+  return true;
+}
+
+bool DBGP_SetFontStyle(DBGP_Font* font, int style) {
+  if (font == NULL) {
+    return false;
+  }
+  if (style != DBGP_STYLE_PLAIN &&
+      ((style & ~ALL_STYLES) != 0 || (style & (style - 1)) != 0 ||
+       font->style_atlases[get_style_index(style)].nb_pages == 0)) {
+    return SDL_SetError("Font style 0x%x wasn't created", style);
+  }
+  font->style = style;
+  return true;
+}
+
+// An atlas packed into the texture of a font group
+typedef struct {
+  DBGP_Font* font;
+  DBGP_FontAtlas* atlas;
+  int style;
+  int x; // the position of the atlas in the group texture
+  int y;
+} group_member;
+
+static int compare_member_heights(const void* a, const void* b) {
+  const int ha = ((const group_member*) a)->atlas->height;
+  const int hb = ((const group_member*) b)->atlas->height;
+  return (hb > ha) - (hb < ha);
+}
+
+// Places atlases (sorted by decreasing height) on shelves of a page of the
+// given width, and returns the page height.
+static int pack_group(group_member* members, int nb_members, int width) {
+  int x = 0;
+  int y = 0;
+  int shelf_height = 0;
+  for (int i = 0; i < nb_members; i++) {
+    const DBGP_FontAtlas* atlas = members[i].atlas;
+    if (x + atlas->width > width) {
+      y += shelf_height;
+      x = 0;
+      shelf_height = 0;
+    }
+    members[i].x = x;
+    members[i].y = y;
+    x += atlas->width;
+    shelf_height = SDL_max(shelf_height, atlas->height);
+  }
+  return y + shelf_height;
+}
+
+// Draws the atlases of the members of a group into a surface, and uploads
+// it into the group texture.
+static bool create_group_texture(
+    DBGP_FontGroup* group, SDL_Renderer* renderer, group_member* members,
+    int nb_members) {
+  SDL_Surface* surface =
+      SDL_CreateSurface(group->width, group->height, group->format);
+  if (surface == NULL) {
+    return false;
+  }
+  const int bpp = SDL_BYTESPERPIXEL(group->format);
+  bool result = true;
+  for (int i = 0; i < nb_members && result; i++) {
+    const group_member* member = &members[i];
+    const DBGP_FontAtlas* atlas = member->atlas;
+    const unsigned int count = member->font->nb_glyphs;
+    SDL_Surface* src =
+        member->style == DBGP_STYLE_PLAIN
+            ? create_atlas_surface(member->font, atlas, 0, count)
+            : create_style_surface(
+                  member->font, atlas, member->style, 0, count);
+    result = src != NULL;
+    for (int row = 0; result && row < atlas->height; row++) {
+      SDL_memcpy(
+          (Uint8*) surface->pixels + (member->y + row) * surface->pitch +
+              member->x * bpp,
+          (const Uint8*) src->pixels + row * src->pitch,
+          (size_t) atlas->width * bpp);
+    }
+    SDL_DestroySurface(src);
+  }
+
+  if (result) {
+    group->texture = SDL_CreateTexture(
+        renderer, group->format, SDL_TEXTUREACCESS_STATIC, group->width,
+        group->height);
+    result = group->texture != NULL &&
+             SDL_UpdateTexture(
+                 group->texture, NULL, surface->pixels, surface->pitch);
+  }
+  if (result) {
+    SDL_SetTextureScaleMode(group->texture, SDL_SCALEMODE_NEAREST);
+    SDL_SetTextureBlendMode(group->texture, SDL_BLENDMODE_BLEND);
+  }
+  SDL_DestroySurface(surface);
+  return result;
+}
+
+bool DBGP_CreateFontGroup(
+    DBGP_FontGroup* group, SDL_Renderer* renderer, DBGP_Font* const* fonts,
+    int nb_fonts) {
+  if (group == NULL || renderer == NULL || fonts == NULL || nb_fonts <= 0) {
+    return false;
+  }
+  SDL_memset(group, 0, sizeof(*group));
+
+  const arena_mark mark = get_arena_mark();
+  group_member* members = arena_alloc(
+      (size_t) nb_fonts * (DBGP_NB_STYLES + 1) * sizeof(group_member));
+  if (members == NULL) {
+    return false;
+  }
+  int nb_members = 0;
+  Uint64 area = 0;
+  int max_width = 0;
+  for (int i = 0; i < nb_fonts; i++) {
+    if (fonts[i] == NULL || fonts[i]->tex == NULL) {
+      release_arena(mark);
+      return SDL_SetError("Invalid font");
+    }
+    for (int style = -1; style < DBGP_NB_STYLES; style++) {
+      DBGP_FontAtlas* atlas =
+          style < 0 ? &fonts[i]->atlas : &fonts[i]->style_atlases[style];
+      if (atlas->nb_pages == 0) {
+        continue;
+      }
+      if (atlas->shared || atlas->nb_pages > 1 ||
+          (nb_members > 0 && atlas->format != members[0].atlas->format)) {
+        release_arena(mark);
+        return SDL_SetError(
+            "Font %d is already grouped, has several pages or another "
+            "texture format",
+            i);
+      }
+      members[nb_members].font = fonts[i];
+      members[nb_members].atlas = atlas;
+      members[nb_members].style = style < 0 ? DBGP_STYLE_PLAIN : 1 << style;
+      nb_members++;
+      area += (Uint64) atlas->width * atlas->height;
+      max_width = SDL_max(max_width, atlas->width);
+    }
+  }
+  SDL_qsort(members, nb_members, sizeof(*members), compare_member_heights);
+
+  // the narrowest power of two wide page whose height fits the maximum size
+  atlas_target target;
+  get_atlas_target(renderer, &target);
+  const int max_size = target.max_size;
+  int width = 1;
+  while (width < max_width || (Uint64) width * width < area) {
+    width *= 2;
+  }
+  int height = 0;
+  for (; width <= max_size; width *= 2) {
+    height = pack_group(members, nb_members, width);
+    if (height <= max_size) {
+      break;
+    }
+  }
+  if (width > max_size) {
+    release_arena(mark);
+    return SDL_SetError("Fonts don't fit in a %dpx texture", max_size);
+  }
+  group->width = width;
+  group->height = height;
+  group->format = members[0].atlas->format;
+
+  // the fonts are detached from the texture when the group is destroyed
+  group->fonts = mem_malloc(nb_fonts * sizeof(DBGP_Font*));
+  if (group->fonts == NULL) {
+    release_arena(mark);
+    return false;
+  }
+  SDL_memcpy(group->fonts, fonts, nb_fonts * sizeof(DBGP_Font*));
+  group->nb_fonts = nb_fonts;
+
+  if (!create_group_texture(group, renderer, members, nb_members)) {
+    release_arena(mark);
+    DBGP_DestroyFontGroup(group);
+    return false;
+  }
+
+  // the glyph grids of the fonts are now regions of the group texture
+  for (int i = 0; i < nb_members; i++) {
+    DBGP_FontAtlas* atlas = members[i].atlas;
+    SDL_DestroyTexture(atlas->pages[0]);
+    atlas->pages[0] = group->texture;
+    atlas->x = members[i].x;
+    atlas->y = members[i].y;
+    atlas->width = group->width;
+    atlas->height = group->height;
+    atlas->shared = true;
+    if (atlas == &members[i].font->atlas) {
+      members[i].font->tex = group->texture;
+    }
+  }
+  release_arena(mark);
+  return true;
+}
+
+void DBGP_DestroyFontGroup(DBGP_FontGroup* group) {
+  if (group == NULL) {
+    return;
+  }
+  // the atlases in the texture are removed from the fonts (unless the fonts
+  // were destroyed or created again since), which can't draw anymore
+  for (int i = 0; i < group->nb_fonts && group->texture != NULL; i++) {
+    DBGP_Font* font = group->fonts[i];
+    for (int style = -1; style < DBGP_NB_STYLES; style++) {
+      DBGP_FontAtlas* atlas =
+          style < 0 ? &font->atlas : &font->style_atlases[style];
+      if (atlas->shared && atlas->pages[0] == group->texture) {
+        free_atlas(atlas);
+      }
+    }
+    if (font->tex == group->texture) {
+      font->tex = NULL;
+    }
+  }
+  if (group->texture != NULL) {
+    SDL_DestroyTexture(group->texture);
+  }
+  mem_free(group->fonts);
+  SDL_memset(group, 0, sizeof(*group));
+}
+
+// Returns the atlas of a font for a style, or its plain atlas if the style
+// wasn't created (e.g. for a fallback font).
+static inline const DBGP_FontAtlas* get_style_atlas(
+    const DBGP_Font* font, int style) {
+  if (style != DBGP_STYLE_PLAIN) {
+    const DBGP_FontAtlas* atlas =
+        &font->style_atlases[get_style_index(style)];
+    if (atlas->nb_pages > 0) {
+      return atlas;
+    }
+  }
+  return &font->atlas;
+}
+
+// Returns the index of the glyph of a codepoint, or nb_glyphs if the font
+// has no glyph for it.
+static inline Uint32 find_glyph(const DBGP_Font* font, Uint32 cp) {
+  if (font->codepoints == NULL) {
+    return cp < font->nb_glyphs ? cp : font->nb_glyphs;
+  }
+  unsigned int lo = 0;
+  unsigned int hi = font->nb_codepoints;
+  while (lo < hi) {
+    unsigned int mid = lo + (hi - lo) / 2;
+    if (font->codepoints[mid] < cp) {
+      lo = mid + 1;
+    } else {
+      hi = mid;
+    }
+  }
+  if (lo < font->nb_codepoints && font->codepoints[lo] == cp) {
+    return font->codepoint_glyphs[lo];
+  }
+  return font->nb_glyphs;
+}
+
+// Fallback cache entries: glyph index << 32 | font index << 24 | codepoint,
+// where font index 0 is the font itself, 1 its first fallback... and
+// FALLBACK_MISSING a codepoint found in no font.
+#define FALLBACK_EMPTY 0x1fffff
+#define FALLBACK_MISSING 0xff
+
+bool DBGP_SetFontFallbacks(
+    DBGP_Font* font, DBGP_Font* const* fallbacks, int nb_fallbacks) {
+  if (font == NULL || nb_fallbacks < 0 ||
+      (fallbacks == NULL && nb_fallbacks > 0)) {
+    return false;
+  }
+  if (nb_fallbacks >= FALLBACK_MISSING) {
+    return SDL_SetError("Too many fallback fonts");
+  }
+  for (int i = 0; i < nb_fallbacks; i++) {
+    if (fallbacks[i] == NULL || fallbacks[i] == font) {
+      return SDL_SetError("Invalid fallback font");
+    }
+    if (fallbacks[i]->glyph_height != font->glyph_height) {
+      return SDL_SetError(
+          "Fallback font glyph height is %d, not %d",
+          fallbacks[i]->glyph_height, font->glyph_height);
+    }
+  }
+
+  mem_free(font->fallbacks);
+  font->fallbacks = NULL;
+  font->nb_fallbacks = 0;
+  if (nb_fallbacks == 0) {
+    mem_free(font->fallback_cache);
+    font->fallback_cache = NULL;
+    return true;
+  }
+
+  font->fallbacks = mem_malloc(nb_fallbacks * sizeof(DBGP_Font*));
+  if (font->fallback_cache == NULL) {
+    font->fallback_cache =
+        mem_malloc(DBGP_FALLBACK_CACHE_SIZE * sizeof(Uint64));
+  }
+  if (font->fallbacks == NULL || font->fallback_cache == NULL) {
+    mem_free(font->fallbacks);
+    font->fallbacks = NULL;
+    return false;
+  }
+  SDL_memcpy(font->fallbacks, fallbacks, nb_fallbacks * sizeof(DBGP_Font*));
+  font->nb_fallbacks = nb_fallbacks;
+  for (int i = 0; i < DBGP_FALLBACK_CACHE_SIZE; i++) {
+    font->fallback_cache[i] = FALLBACK_EMPTY;
+  }
+
+  return true;
+}
+
+// Looks a codepoint up in a font and its fallbacks, returning a fallback
+// cache entry.
+static Uint64 resolve_fallbacks(const DBGP_Font* font, Uint32 cp) {
+  Uint32 glyph = find_glyph(font, cp);
+  if (glyph < font->nb_glyphs) {
+    return (Uint64) glyph << 32 | cp;
+  }
+  for (int i = 0; i < font->nb_fallbacks; i++) {
+    glyph = find_glyph(font->fallbacks[i], cp);
+    if (glyph < font->fallbacks[i]->nb_glyphs) {
+      return (Uint64) glyph << 32 | (Uint32) (i + 1) << 24 | cp;
+    }
+  }
+  return (Uint32) FALLBACK_MISSING << 24 | cp;
+}
+
+// Returns the font having the glyph of a codepoint (font itself or one of its
+// fallbacks) and stores the glyph index, or returns NULL if no font has it.
+static inline const DBGP_Font* resolve_glyph(
+    DBGP_Font* font, Uint32 cp, Uint32* glyph) {
+  if (font->nb_fallbacks == 0) {
+    *glyph = find_glyph(font, cp);
+    return *glyph < font->nb_glyphs ? font : NULL;
+  }
+
+  Uint64* entry = &font->fallback_cache[cp & (DBGP_FALLBACK_CACHE_SIZE - 1)];
+  if ((*entry & FALLBACK_EMPTY) != cp) {
+    *entry = resolve_fallbacks(font, cp);
+  }
+  const Uint32 index = (*entry >> 24) & 0xff;
+  *glyph = *entry >> 32;
+  if (index == 0) {
+    return font;
+  }
+  return index != FALLBACK_MISSING ? font->fallbacks[index - 1] : NULL;
+}
+
+// Returns the texture of an atlas containing a glyph and fills the position
+// of its cell in the texture.
+static inline SDL_Texture* get_glyph_source(
+    const DBGP_FontAtlas* atlas, Uint32 glyph, SDL_FRect* src) {
+  const unsigned int index = glyph % atlas->glyphs_per_page;
+  src->x = atlas->x + index % atlas->glyphs_per_line * atlas->cell_width;
+  src->y = atlas->y + index / atlas->glyphs_per_line * atlas->cell_height;
+  src->w = atlas->cell_width;
+  src->h = atlas->cell_height;
+  return atlas->pages[glyph / atlas->glyphs_per_page];
+}
+
+// BEGIN ucd2width.py (Unicode 14.0.0, do not edit)
+// The number of cells (0, 1 or 2) of each codepoint, in a two-stage
+// table: width_blocks[width_index[cp >> 8]] holds the widths of the 256
+// codepoints of the block of cp, 2 bits each.
+#define WIDTH_NB_BLOCKS 129
+static const Uint8 width_index[0x1100] = {
+    0x00, 0x00, 0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09,
+    0x0a, 0x0b, 0x0c, 0x0d, 0x0e, 0x0f, 0x10, 0x11, 0x00, 0x00, 0x12, 0x13,
+    0x14, 0x15, 0x16, 0x17, 0x18, 0x19, 0x00, 0x1a, 0x1b, 0x1c, 0x00, 0x1d,
+    0x1e, 0x1f, 0x20, 0x21, 0x00, 0x00, 0x00, 0x22, 0x23, 0x24, 0x25, 0x26,
+    0x27, 0x26, 0x28, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26,
+    0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26,
+    0x26, 0x26, 0x26, 0x26, 0x26, 0x29, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26,
+    0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26,
+    0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26,
+    0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26,
+    0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26,
+    0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26,
+    0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26,
+    0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x2a, 0x00, 0x2b, 0x2c,
+    0x2d, 0x2e, 0x2f, 0x30, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26,
+    0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26,
+    0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26,
+    0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x31,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x26, 0x26, 0x32,
+    0x00, 0x33, 0x34, 0x35, 0x36, 0x37, 0x38, 0x39, 0x3a, 0x3b, 0x00, 0x3c,
+    0x3d, 0x3e, 0x3f, 0x40, 0x41, 0x42, 0x43, 0x44, 0x45, 0x46, 0x47, 0x48,
+    0x49, 0x4a, 0x4b, 0x4c, 0x4d, 0x4e, 0x4f, 0x26, 0x50, 0x51, 0x52, 0x53,
+    0x00, 0x00, 0x00, 0x54, 0x55, 0x56, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26,
+    0x26, 0x26, 0x26, 0x57, 0x00, 0x00, 0x00, 0x00, 0x58, 0x26, 0x26, 0x26,
+    0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26,
+    0x00, 0x00, 0x59, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26,
+    0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26,
+    0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26,
+    0x00, 0x00, 0x5a, 0x5b, 0x26, 0x26, 0x5c, 0x5d, 0x26, 0x26, 0x26, 0x26,
+    0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26,
+    0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26,
+    0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26,
+    0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26,
+    0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26,
+    0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26,
+    0x5e, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26,
+    0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x5f, 0x60, 0x61, 0x62, 0x63,
+    0x64, 0x65, 0x66, 0x67, 0x00, 0x00, 0x68, 0x26, 0x26, 0x26, 0x26, 0x69,
+    0x6a, 0x6b, 0x6c, 0x26, 0x26, 0x26, 0x26, 0x6d, 0x6e, 0x6f, 0x26, 0x26,
+    0x70, 0x71, 0x72, 0x26, 0x73, 0x74, 0x26, 0x75, 0x76, 0x77, 0x78, 0x79,
+    0x7a, 0x7b, 0x7c, 0x7d, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26,
+    0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26,
+    0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26,
+    0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26,
+    0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26,
+    0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26,
+    0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26,
+    0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26,
+    0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26,
+    0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26,
+    0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26,
+    0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26,
+    0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26,
+    0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26,
+    0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26,
+    0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26,
+    0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26,
+    0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26,
+    0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26,
+    0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26,
+    0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26,
+    0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26,
+    0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26,
+    0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26,
+    0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26,
+    0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26,
+    0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26,
+    0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26,
+    0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26,
+    0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26,
+    0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26,
+    0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26,
+    0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26,
+    0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26,
+    0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26,
+    0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26,
+    0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26,
+    0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26,
+    0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26,
+    0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26,
+    0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26,
+    0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26,
+    0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26,
+    0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26,
+    0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26,
+    0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26,
+    0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26,
+    0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26,
+    0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26,
+    0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26,
+    0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26,
+    0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26,
+    0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26,
+    0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26,
+    0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26,
+    0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26,
+    0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26,
+    0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26,
+    0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26,
+    0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26,
+    0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26,
+    0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26,
+    0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26,
+    0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26,
+    0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26,
+    0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26,
+    0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26,
+    0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26,
+    0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26,
+    0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26,
+    0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26,
+    0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26,
+    0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26,
+    0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26,
+    0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26,
+    0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26,
+    0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26,
+    0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26,
+    0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26,
+    0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26,
+    0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26,
+    0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26,
+    0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26,
+    0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26,
+    0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26,
+    0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26,
+    0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26,
+    0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26,
+    0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26,
+    0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26,
+    0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26,
+    0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26,
+    0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26,
+    0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26,
+    0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26,
+    0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26,
+    0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26,
+    0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26,
+    0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26,
+    0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26,
+    0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26,
+    0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26,
+    0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26,
+    0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26,
+    0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26,
+    0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26,
+    0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26,
+    0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26,
+    0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26,
+    0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26,
+    0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26,
+    0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26,
+    0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26,
+    0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26,
+    0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26,
+    0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26,
+    0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26,
+    0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26,
+    0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26,
+    0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26,
+    0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26,
+    0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26,
+    0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26,
+    0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26,
+    0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26,
+    0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26,
+    0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26,
+    0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26,
+    0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26,
+    0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26,
+    0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26,
+    0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26,
+    0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26,
+    0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26,
+    0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26,
+    0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26,
+    0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26,
+    0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26,
+    0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26,
+    0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26,
+    0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26,
+    0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26,
+    0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26,
+    0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26,
+    0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26,
+    0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26,
+    0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26,
+    0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26,
+    0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26,
+    0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26,
+    0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26,
+    0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26,
+    0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26,
+    0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26,
+    0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26,
+    0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26,
+    0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26,
+    0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26,
+    0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26,
+    0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26,
+    0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26,
+    0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26,
+    0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26,
+    0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26,
+    0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26,
+    0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26,
+    0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26,
+    0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26,
+    0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26,
+    0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26,
+    0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26,
+    0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26,
+    0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26,
+    0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26,
+    0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26,
+    0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26,
+    0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26,
+    0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26,
+    0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26,
+    0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26,
+    0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26,
+    0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26,
+    0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26,
+    0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26,
+    0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26,
+    0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26,
+    0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26,
+    0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26,
+    0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26,
+    0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26,
+    0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26,
+    0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26,
+    0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26,
+    0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26,
+    0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26,
+    0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26,
+    0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26,
+    0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26,
+    0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26,
+    0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26,
+    0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26,
+    0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26,
+    0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26,
+    0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26,
+    0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26,
+    0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26,
+    0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26,
+    0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26,
+    0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26,
+    0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26,
+    0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26,
+    0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26,
+    0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26,
+    0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26,
+    0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26,
+    0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26,
+    0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26,
+    0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26,
+    0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26,
+    0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26,
+    0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26,
+    0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26,
+    0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26,
+    0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26,
+    0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26,
+    0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26,
+    0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26,
+    0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26,
+    0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26,
+    0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26,
+    0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26,
+    0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26,
+    0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26,
+    0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26,
+    0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26,
+    0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26,
+    0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26,
+    0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26,
+    0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26,
+    0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26,
+    0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26,
+    0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26,
+    0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26,
+    0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26,
+    0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26,
+    0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26,
+    0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26,
+    0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26,
+    0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26,
+    0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26,
+    0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26,
+    0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26,
+    0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26,
+    0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26,
+    0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26,
+    0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26,
+    0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x7e, 0x7f, 0x26, 0x26,
+    0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26,
+    0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26,
+    0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26,
+    0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26,
+    0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26,
+    0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26,
+    0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26,
+    0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26,
+    0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26,
+    0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26,
+    0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26,
+    0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26,
+    0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26,
+    0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26,
+    0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26,
+    0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26,
+    0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26,
+    0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26,
+    0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26,
+    0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26,
+    0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80,
+};
+static const Uint8 width_blocks[WIDTH_NB_BLOCKS][64] = {
+    {0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+     0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+     0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+     0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+     0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+     0x55, 0x55, 0x55, 0x55},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+     0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+     0x00, 0x00, 0x00, 0x00, 0x55, 0x55, 0x5a, 0x55, 0xaa, 0x55, 0x95, 0x59,
+     0x55, 0x55, 0x55, 0x55, 0x65, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+     0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+     0x55, 0x55, 0x55, 0x55},
+    {0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+     0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+     0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x15, 0x00, 0x50, 0x55,
+     0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+     0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+     0x55, 0x55, 0x55, 0x55},
+    {0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+     0x56, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x95, 0x56, 0x55,
+     0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x95, 0x56,
+     0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10,
+     0x41, 0x10, 0xaa, 0xaa, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x95, 0x6a,
+     0x55, 0xa9, 0xaa, 0xaa},
+    {0x55, 0x55, 0x55, 0x55, 0x00, 0x00, 0x40, 0x54, 0x55, 0x55, 0x55, 0x55,
+     0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x15, 0x00, 0x00, 0x00, 0x00, 0x00,
+     0x55, 0x55, 0x55, 0x55, 0x54, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+     0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+     0x55, 0x55, 0x55, 0x55, 0x55, 0x05, 0x00, 0x14, 0x00, 0x14, 0x04, 0x50,
+     0x55, 0x55, 0x55, 0x55},
+    {0x55, 0x55, 0x55, 0x65, 0x51, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+     0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x56, 0x55, 0x55, 0x55, 0x55,
+     0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+     0x55, 0x55, 0x55, 0x55, 0x55, 0x05, 0x00, 0x00, 0xa4, 0xaa, 0xaa, 0xaa,
+     0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x15, 0x00,
+     0x00, 0x55, 0x95, 0x52},
+    {0x55, 0x55, 0x55, 0x55, 0x55, 0x05, 0x10, 0x00, 0x00, 0x01, 0x01, 0xa0,
+     0x55, 0x55, 0x55, 0x95, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x01, 0x9a,
+     0x55, 0x55, 0x95, 0xaa, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x95,
+     0xa5, 0xaa, 0x00, 0x00, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+     0x55, 0x55, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00,
+     0x00, 0x00, 0x00, 0x00},
+    {0x40, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+     0x55, 0x55, 0x45, 0x54, 0x01, 0x00, 0x54, 0x51, 0x01, 0x00, 0x55, 0x55,
+     0x05, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x51, 0x56, 0x55, 0x69,
+     0x69, 0x55, 0x55, 0x55, 0x55, 0x55, 0x59, 0x55, 0x99, 0x5a, 0xa5, 0x54,
+     0x01, 0x68, 0x69, 0x91, 0xaa, 0x6a, 0xaa, 0x65, 0x05, 0x5a, 0x55, 0x55,
+     0x55, 0x55, 0x55, 0x85},
+    {0x42, 0x56, 0x95, 0x6a, 0x69, 0x55, 0x55, 0x55, 0x55, 0x55, 0x59, 0x55,
+     0x59, 0x96, 0xa5, 0x58, 0x81, 0x2a, 0x28, 0xa0, 0xa2, 0xaa, 0x56, 0x99,
+     0xaa, 0x5a, 0x55, 0x55, 0x50, 0x91, 0xaa, 0xaa, 0x42, 0x56, 0x55, 0x65,
+     0x65, 0x55, 0x55, 0x55, 0x55, 0x55, 0x59, 0x55, 0x59, 0x56, 0xa5, 0x54,
+     0x01, 0x20, 0x64, 0xa1, 0xa9, 0xaa, 0xaa, 0xaa, 0x05, 0x5a, 0x55, 0x55,
+     0xa5, 0xaa, 0x06, 0x00},
+    {0x52, 0x56, 0x55, 0x69, 0x69, 0x55, 0x55, 0x55, 0x55, 0x55, 0x59, 0x55,
+     0x59, 0x56, 0xa5, 0x14, 0x01, 0x68, 0x69, 0xa1, 0xaa, 0x42, 0xaa, 0x65,
+     0x05, 0x5a, 0x55, 0x55, 0x55, 0x55, 0xaa, 0xaa, 0x4a, 0x56, 0x95, 0x5a,
+     0x59, 0xa5, 0x96, 0x59, 0x6a, 0xa9, 0x95, 0x5a, 0x55, 0x55, 0xa5, 0x5a,
+     0x94, 0x5a, 0x59, 0xa1, 0xa9, 0x6a, 0xaa, 0xaa, 0xaa, 0x5a, 0x55, 0x55,
+     0x55, 0x55, 0x95, 0xaa},
+    {0x54, 0x54, 0x55, 0x59, 0x59, 0x55, 0x55, 0x55, 0x55, 0x55, 0x59, 0x55,
+     0x55, 0x55, 0xa5, 0x04, 0x54, 0x09, 0x08, 0xa0, 0xaa, 0x82, 0x95, 0xa6,
+     0x05, 0x5a, 0x55, 0x55, 0xaa, 0x6a, 0x55, 0x55, 0x51, 0x55, 0x55, 0x59,
+     0x59, 0x55, 0x55, 0x55, 0x55, 0x55, 0x59, 0x55, 0x55, 0x56, 0xa5, 0x14,
+     0x55, 0x49, 0x59, 0xa0, 0xaa, 0x96, 0xaa, 0x96, 0x05, 0x5a, 0x55, 0x55,
+     0x96, 0xaa, 0xaa, 0xaa},
+    {0x50, 0x55, 0x55, 0x59, 0x59, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+     0x55, 0x55, 0x15, 0x54, 0x01, 0x58, 0x59, 0x51, 0xaa, 0x55, 0x55, 0x55,
+     0x05, 0x5a, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x52, 0x56, 0x55, 0x55,
+     0x55, 0x95, 0x5a, 0x55, 0x55, 0x55, 0x55, 0x55, 0x65, 0x55, 0x55, 0xa6,
+     0x55, 0x95, 0x8a, 0x6a, 0x05, 0x88, 0x55, 0x55, 0xaa, 0x5a, 0x55, 0x55,
+     0x5a, 0xa9, 0xaa, 0xaa},
+    {0x56, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+     0x51, 0x00, 0x80, 0x6a, 0x55, 0x15, 0x00, 0x40, 0x55, 0x55, 0x55, 0xaa,
+     0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0x96, 0x59, 0x95, 0x55,
+     0x55, 0x55, 0x55, 0x55, 0x55, 0x66, 0x55, 0x55, 0x51, 0x00, 0x00, 0xa4,
+     0x55, 0x99, 0x00, 0xa0, 0x55, 0x55, 0xa5, 0x55, 0xaa, 0xaa, 0xaa, 0xaa,
+     0xaa, 0xaa, 0xaa, 0xaa},
+    {0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x50, 0x55, 0x55, 0x55, 0x55, 0x55,
+     0x55, 0x11, 0x51, 0x55, 0x55, 0x55, 0x56, 0x55, 0x55, 0x55, 0x55, 0x55,
+     0x55, 0x55, 0x55, 0xa9, 0x02, 0x00, 0x00, 0x40, 0x00, 0x04, 0x55, 0x01,
+     0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x58,
+     0x55, 0x45, 0x55, 0x59, 0x55, 0x55, 0x95, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa,
+     0xaa, 0xaa, 0xaa, 0xaa},
+    {0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x01,
+     0x04, 0x00, 0x41, 0x41, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x50, 0x05,
+     0x54, 0x55, 0x55, 0x55, 0x01, 0x54, 0x55, 0x55, 0x45, 0x41, 0x55, 0x51,
+     0x55, 0x55, 0x55, 0x51, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+     0x55, 0x65, 0xaa, 0xa6, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+     0x55, 0x55, 0x55, 0x55},
+    {0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa,
+     0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa,
+     0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+     0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+     0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+     0x00, 0x00, 0x00, 0x00},
+    {0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+     0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x59, 0xa5, 0x55, 0x95, 0x59, 0xa5,
+     0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x59, 0xa5,
+     0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x59, 0xa5, 0x55, 0x95,
+     0x59, 0xa5, 0x55, 0x55, 0x55, 0x95, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+     0x55, 0x55, 0x55, 0x55},
+    {0x55, 0x55, 0x55, 0x55, 0x59, 0xa5, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+     0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x95, 0x02,
+     0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0xa9, 0x55, 0x55, 0x55, 0x55,
+     0x55, 0x55, 0xa5, 0xaa, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+     0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+     0x55, 0xa5, 0x55, 0xa5},
+    {0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+     0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+     0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+     0x55, 0x55, 0x55, 0xa9, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+     0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+     0x55, 0x55, 0xa9, 0xaa},
+    {0x55, 0x55, 0x55, 0x55, 0x05, 0xa4, 0xaa, 0x6a, 0x55, 0x55, 0x55, 0x55,
+     0x05, 0x95, 0xaa, 0xaa, 0x55, 0x55, 0x55, 0x55, 0x05, 0xaa, 0xaa, 0xaa,
+     0x55, 0x55, 0x55, 0x59, 0x09, 0xaa, 0xaa, 0xaa, 0x55, 0x55, 0x55, 0x55,
+     0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x10, 0x00, 0x50,
+     0x55, 0x45, 0x01, 0x00, 0x00, 0x55, 0x55, 0xa1, 0x55, 0x55, 0xa5, 0xaa,
+     0x55, 0x55, 0xa5, 0xaa},
+    {0x55, 0x55, 0x15, 0x00, 0x55, 0x55, 0xa5, 0xaa, 0x55, 0x55, 0x55, 0x55,
+     0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+     0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0xa9, 0xaa, 0x55, 0x41, 0x55, 0x55,
+     0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x91, 0xaa, 0x55, 0x55, 0x55, 0x55,
+     0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+     0x55, 0xa5, 0xaa, 0xaa},
+    {0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x95, 0x40, 0x15, 0x54, 0xaa,
+     0x45, 0x55, 0x01, 0xaa, 0xa9, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+     0x55, 0x55, 0x55, 0xa5, 0x55, 0xa9, 0xaa, 0xaa, 0x55, 0x55, 0x55, 0x55,
+     0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0xaa, 0x55, 0x55, 0x55, 0x55,
+     0x55, 0x55, 0xa5, 0xaa, 0x55, 0x55, 0x95, 0x5a, 0x55, 0x55, 0x55, 0x55,
+     0x55, 0x55, 0x55, 0x55},
+    {0x55, 0x55, 0x55, 0x55, 0x55, 0x15, 0x14, 0x5a, 0x55, 0x55, 0x55, 0x55,
+     0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x45, 0x00, 0x80,
+     0x44, 0x01, 0x00, 0x54, 0x15, 0x00, 0x00, 0x28, 0x55, 0x55, 0xa5, 0xaa,
+     0x55, 0x55, 0xa5, 0xaa, 0x55, 0x55, 0x55, 0xa5, 0x00, 0x00, 0x00, 0x00,
+     0x00, 0x00, 0x00, 0x80, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa,
+     0xaa, 0xaa, 0xaa, 0xaa},
+    {0x00, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+     0x55, 0x04, 0x40, 0x54, 0x45, 0x55, 0x55, 0xa9, 0x55, 0x55, 0x55, 0x55,
+     0x55, 0x55, 0x15, 0x00, 0x00, 0x55, 0x55, 0x95, 0x50, 0x55, 0x55, 0x55,
+     0x55, 0x55, 0x55, 0x55, 0x05, 0x50, 0x10, 0x50, 0x55, 0x55, 0x55, 0x55,
+     0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x45, 0x50, 0x11,
+     0x50, 0xaa, 0xaa, 0x55},
+    {0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x00,
+     0x00, 0x05, 0x6a, 0x55, 0x55, 0x55, 0xa5, 0x56, 0x55, 0x55, 0x55, 0x55,
+     0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0xa9, 0xaa,
+     0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x95, 0x56,
+     0x55, 0x55, 0xaa, 0xaa, 0x40, 0x00, 0x00, 0x00, 0x04, 0x00, 0x54, 0x51,
+     0x55, 0x54, 0x90, 0xaa},
+    {0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+     0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+     0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+     0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+     0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+     0x00, 0x00, 0x00, 0x00},
+    {0x55, 0x55, 0x55, 0x55, 0x55, 0xa5, 0x55, 0xa5, 0x55, 0x55, 0x55, 0x55,
+     0x55, 0x55, 0x55, 0x55, 0x55, 0xa5, 0x55, 0xa5, 0x55, 0x55, 0x66, 0x66,
+     0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0xa5, 0x55, 0x55, 0x55, 0x55,
+     0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x59, 0x55, 0x55,
+     0x55, 0x59, 0x55, 0x55, 0x55, 0x5a, 0x55, 0x56, 0x55, 0x55, 0x55, 0x55,
+     0x5a, 0x59, 0x55, 0x95},
+    {0x55, 0x55, 0x15, 0x00, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x05, 0x40,
+     0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+     0x00, 0x08, 0x00, 0x00, 0xa5, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x95,
+     0x55, 0x55, 0x55, 0xa9, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+     0xa9, 0xaa, 0xaa, 0xaa, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+     0xa8, 0xaa, 0xaa, 0xaa},
+    {0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+     0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+     0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0xaa,
+     0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+     0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+     0x55, 0x55, 0x55, 0x55},
+    {0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0xa5, 0x55, 0x55, 0x55, 0x69, 0x55,
+     0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+     0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+     0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+     0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0xa9, 0x56,
+     0x96, 0x55, 0x55, 0x55},
+    {0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x95, 0xaa, 0xaa,
+     0xaa, 0xaa, 0xaa, 0xaa, 0x55, 0x55, 0x95, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa,
+     0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+     0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+     0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+     0x55, 0x55, 0x55, 0x55},
+    {0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+     0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+     0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+     0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+     0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+     0x55, 0x55, 0x55, 0x69},
+    {0x55, 0x55, 0x55, 0x55, 0x55, 0x5a, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+     0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0xaa, 0xaa, 0xaa, 0x55, 0x55, 0x55,
+     0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x95, 0x55, 0x55, 0x55, 0x55,
+     0x95, 0x55, 0x55, 0x55, 0x59, 0x55, 0xa5, 0x55, 0x55, 0x55, 0x55, 0x69,
+     0x55, 0x5a, 0x55, 0x65, 0x55, 0x56, 0x55, 0x55, 0x55, 0x55, 0x65, 0x55,
+     0xa5, 0x59, 0x65, 0x59},
+    {0x55, 0x59, 0xa5, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x56, 0x55,
+     0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x66, 0x95, 0x9a, 0x55, 0x55,
+     0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+     0x55, 0xa9, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x56, 0x55, 0x55, 0x95,
+     0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+     0x55, 0x55, 0x55, 0x55},
+    {0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x95, 0x56, 0x55, 0x55, 0x55, 0x55,
+     0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x56, 0x59, 0x55, 0x55,
+     0x55, 0x55, 0x55, 0x55, 0x55, 0x5a, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+     0x55, 0x65, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+     0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+     0x55, 0x55, 0x55, 0x55},
+    {0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+     0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+     0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+     0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+     0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x15,
+     0x50, 0xaa, 0x56, 0x55},
+    {0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x65, 0xaa, 0xa6,
+     0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+     0x55, 0x55, 0xaa, 0x6a, 0xa9, 0xaa, 0xaa, 0x2a, 0x55, 0x55, 0x55, 0x55,
+     0x55, 0x95, 0xaa, 0xaa, 0x55, 0x95, 0x55, 0x95, 0x55, 0x95, 0x55, 0x95,
+     0x55, 0x95, 0x55, 0x95, 0x55, 0x95, 0x55, 0x95, 0x00, 0x00, 0x00, 0x00,
+     0x00, 0x00, 0x00, 0x00},
+    {0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+     0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0xa5,
+     0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa,
+     0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa,
+     0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa,
+     0xaa, 0xaa, 0xaa, 0xaa},
+    {0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa,
+     0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa,
+     0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa,
+     0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa,
+     0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa,
+     0xaa, 0xaa, 0xaa, 0xaa},
+    {0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0x0a, 0xa0,
+     0xaa, 0xaa, 0xaa, 0x6a, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa,
+     0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa,
+     0xaa, 0xaa, 0x82, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa,
+     0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa,
+     0xaa, 0xaa, 0xaa, 0xaa},
+    {0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa,
+     0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0x55, 0x55, 0xaa, 0xaa, 0xaa, 0xaa,
+     0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa,
+     0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa,
+     0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa,
+     0xaa, 0xaa, 0xaa, 0xaa},
+    {0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa,
+     0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa,
+     0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa,
+     0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa,
+     0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+     0x55, 0x55, 0x55, 0x55},
+    {0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa,
+     0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa,
+     0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa,
+     0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa,
+     0xaa, 0xaa, 0xaa, 0xaa, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+     0x55, 0x55, 0x55, 0x55},
+    {0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0xaa,
+     0xaa, 0xaa, 0xaa, 0xaa, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+     0x55, 0x55, 0x55, 0x15, 0x40, 0x00, 0x00, 0x50, 0x55, 0x55, 0x55, 0x55,
+     0x55, 0x55, 0x55, 0x05, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+     0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+     0x50, 0x55, 0xaa, 0xaa},
+    {0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+     0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+     0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+     0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+     0x55, 0x55, 0x95, 0xaa, 0x65, 0x56, 0xa5, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa,
+     0x5a, 0x55, 0x55, 0x55},
+    {0x45, 0x45, 0x15, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x41, 0x55, 0xa8,
+     0x55, 0x55, 0xa5, 0xaa, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+     0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0xaa, 0xaa, 0x55, 0x55, 0x55, 0x55,
+     0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+     0x55, 0xa0, 0xaa, 0x5a, 0x55, 0x55, 0xa5, 0xaa, 0x00, 0x00, 0x00, 0x00,
+     0x50, 0x55, 0x55, 0x15},
+    {0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x05, 0x00, 0x50,
+     0x55, 0x55, 0x55, 0x55, 0x55, 0x15, 0x00, 0x00, 0x50, 0xaa, 0xaa, 0x6a,
+     0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0x40, 0x55, 0x55, 0x55,
+     0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x15, 0x05, 0x50, 0x50,
+     0x55, 0x55, 0x55, 0x65, 0x55, 0x55, 0xa5, 0x5a, 0x55, 0x51, 0x55, 0x55,
+     0x55, 0x55, 0x55, 0x95},
+    {0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x01, 0x40,
+     0x41, 0x81, 0xaa, 0xaa, 0x15, 0x55, 0x55, 0xa4, 0x55, 0x55, 0xa5, 0x55,
+     0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x54, 0x55, 0x55, 0x55, 0x55,
+     0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x04, 0x14, 0x54, 0x05,
+     0x91, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0x6a, 0x55, 0x55, 0x55, 0x55, 0x50,
+     0x55, 0x85, 0xaa, 0xaa},
+    {0x56, 0x95, 0x56, 0x95, 0x56, 0x95, 0xaa, 0xaa, 0x55, 0x95, 0x55, 0x95,
+     0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+     0x55, 0x55, 0x55, 0xaa, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+     0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+     0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x51, 0x54, 0xa1,
+     0x55, 0x55, 0xa5, 0xaa},
+    {0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa,
+     0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa,
+     0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa,
+     0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0x00, 0x00, 0x00, 0x00,
+     0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+     0x00, 0x00, 0x00, 0x00},
+    {0x55, 0x95, 0xaa, 0xaa, 0x6a, 0x55, 0xaa, 0x46, 0x55, 0x55, 0x55, 0x55,
+     0x55, 0x95, 0x55, 0x99, 0x65, 0x59, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+     0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+     0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+     0x95, 0xaa, 0xaa, 0xaa, 0x6a, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+     0x55, 0x55, 0x55, 0x55},
+    {0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+     0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+     0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+     0x5a, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+     0x55, 0x55, 0xaa, 0x6a, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa,
+     0x55, 0x55, 0x55, 0x55},
+    {0x00, 0x00, 0x00, 0x00, 0xaa, 0xaa, 0xaa, 0xaa, 0x00, 0x00, 0x00, 0x00,
+     0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa,
+     0xaa, 0xaa, 0xaa, 0xaa, 0x55, 0x59, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+     0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+     0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+     0x55, 0x55, 0x55, 0x29},
+    {0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa,
+     0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa,
+     0x56, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+     0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x95,
+     0x5a, 0x55, 0x5a, 0x55, 0x5a, 0x55, 0x5a, 0xa9, 0xaa, 0xaa, 0x55, 0x95,
+     0xaa, 0xaa, 0x02, 0xa5},
+    {0x55, 0x55, 0x55, 0x56, 0x55, 0x55, 0x55, 0x55, 0x55, 0x95, 0x55, 0x55,
+     0x55, 0x55, 0x95, 0x65, 0x55, 0x55, 0x55, 0xa5, 0x55, 0x55, 0x55, 0xa5,
+     0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0x55, 0x55, 0x55, 0x55,
+     0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+     0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+     0x55, 0x55, 0x95, 0xaa},
+    {0x95, 0x6a, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+     0x55, 0x6a, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+     0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x95,
+     0x55, 0x55, 0x55, 0xa9, 0xa9, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa,
+     0xaa, 0xaa, 0xaa, 0xaa, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+     0x55, 0x55, 0x55, 0xa1},
+    {0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa,
+     0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa,
+     0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0x55, 0x55, 0x55, 0x55,
+     0x55, 0x55, 0x55, 0xa9, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+     0x55, 0x55, 0x55, 0x55, 0xa9, 0xaa, 0xaa, 0xaa, 0x54, 0x55, 0x55, 0x55,
+     0x55, 0x55, 0x55, 0xaa},
+    {0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0xaa, 0xaa, 0x56,
+     0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x95, 0xaa, 0x55, 0x55, 0x55, 0x55,
+     0x55, 0x55, 0x55, 0x55, 0x55, 0x05, 0x80, 0xaa, 0x55, 0x55, 0x55, 0x55,
+     0x55, 0x55, 0x55, 0x65, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+     0x55, 0xaa, 0x55, 0x55, 0x55, 0xa5, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa,
+     0xaa, 0xaa, 0xaa, 0xaa},
+    {0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+     0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+     0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+     0x55, 0x55, 0x55, 0xa5, 0x55, 0x55, 0xa5, 0xaa, 0x55, 0x55, 0x55, 0x55,
+     0x55, 0x55, 0x55, 0x55, 0x55, 0xaa, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+     0x55, 0x55, 0x55, 0xaa},
+    {0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0xaa, 0xaa,
+     0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+     0x55, 0xaa, 0xaa, 0x6a, 0x55, 0x55, 0x95, 0x55, 0x55, 0x55, 0x95, 0x55,
+     0x95, 0x65, 0x55, 0x55, 0x65, 0x55, 0x55, 0x55, 0x65, 0x55, 0x65, 0xa9,
+     0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa,
+     0xaa, 0xaa, 0xaa, 0xaa},
+    {0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+     0x55, 0x95, 0xaa, 0xaa, 0x55, 0x55, 0x55, 0x55, 0x55, 0xa5, 0xaa, 0xaa,
+     0x55, 0x55, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0x55, 0x65, 0x55, 0x55,
+     0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x59, 0x55, 0x95, 0xaa,
+     0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa,
+     0xaa, 0xaa, 0xaa, 0xaa},
+    {0x55, 0xa5, 0x59, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+     0x55, 0x65, 0xa9, 0x69, 0x55, 0x55, 0x55, 0x55, 0x55, 0x65, 0x55, 0x55,
+     0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+     0x55, 0x55, 0x55, 0x95, 0xaa, 0x6a, 0x55, 0x55, 0xaa, 0xaa, 0xaa, 0xaa,
+     0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0x55, 0x55, 0x55, 0x55,
+     0x95, 0xa5, 0x6a, 0x55},
+    {0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x6a, 0x55, 0x55, 0x55, 0x55,
+     0x55, 0x55, 0xa5, 0x6a, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa,
+     0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0x55, 0x55, 0x55, 0x55,
+     0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0xaa, 0x55,
+     0x55, 0x55, 0x55, 0x55, 0x5a, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+     0x55, 0x55, 0x55, 0x55},
+    {0x01, 0x82, 0xaa, 0x00, 0x55, 0x56, 0x56, 0x55, 0x55, 0x55, 0x55, 0x55,
+     0x55, 0xa5, 0x80, 0x2a, 0x55, 0x55, 0xa9, 0xaa, 0x55, 0x55, 0xa9, 0xaa,
+     0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+     0x55, 0x55, 0x55, 0x55, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa,
+     0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x81, 0x6a, 0x55,
+     0x55, 0x95, 0xaa, 0xaa},
+    {0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+     0x55, 0xa5, 0x56, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0xa5, 0x55, 0x55,
+     0x55, 0x55, 0x55, 0x55, 0x95, 0xaa, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+     0xa5, 0xaa, 0x56, 0xa9, 0xaa, 0xaa, 0x56, 0x55, 0xaa, 0xaa, 0xaa, 0xaa,
+     0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa,
+     0xaa, 0xaa, 0xaa, 0xaa},
+    {0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+     0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0xa9, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa,
+     0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0x55, 0x55, 0x55, 0x55,
+     0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x95, 0xaa, 0xaa, 0xaa,
+     0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+     0x95, 0xaa, 0x5a, 0x55},
+    {0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x00, 0xaa, 0xaa,
+     0x55, 0x55, 0xa5, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa,
+     0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa,
+     0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa,
+     0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa,
+     0xaa, 0xaa, 0xaa, 0xaa},
+    {0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa,
+     0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa,
+     0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x95, 0x55, 0x55, 0x55, 0x55,
+     0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x25, 0xa4, 0xa5, 0xaa, 0xaa, 0xaa,
+     0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa,
+     0xaa, 0xaa, 0xaa, 0xaa},
+    {0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0xaa, 0xaa,
+     0x55, 0x55, 0x55, 0x55, 0x55, 0x05, 0x00, 0x00, 0x54, 0x55, 0xa5, 0xaa,
+     0xaa, 0xaa, 0xaa, 0xaa, 0x55, 0x55, 0x55, 0x55, 0x05, 0x50, 0xa5, 0xaa,
+     0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0x55, 0x55, 0x55, 0x55,
+     0x55, 0x55, 0x55, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0x55, 0x55, 0x55, 0x55,
+     0x55, 0x95, 0xaa, 0xaa},
+    {0x51, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+     0x55, 0x55, 0x00, 0x00, 0x00, 0x40, 0x55, 0xa5, 0x5a, 0x55, 0x55, 0x55,
+     0x55, 0x55, 0x55, 0x55, 0x14, 0xa4, 0xaa, 0x2a, 0x50, 0x55, 0x55, 0x55,
+     0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x15, 0x40, 0x41, 0x55,
+     0x85, 0xaa, 0xaa, 0xa6, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0xa9, 0xaa,
+     0x55, 0x55, 0xa5, 0xaa},
+    {0x40, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x15, 0x00, 0x01,
+     0x00, 0x58, 0x55, 0x55, 0x55, 0x55, 0xaa, 0xaa, 0x55, 0x55, 0x55, 0x55,
+     0x55, 0x55, 0x55, 0x55, 0x15, 0x95, 0xaa, 0xaa, 0x50, 0x55, 0x55, 0x55,
+     0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x05, 0x00, 0x40,
+     0x55, 0x55, 0x01, 0x14, 0x55, 0x55, 0x55, 0x55, 0x56, 0x55, 0x55, 0x55,
+     0x55, 0xa9, 0xaa, 0xaa},
+    {0x55, 0x55, 0x55, 0x55, 0x65, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x15,
+     0x50, 0x04, 0x55, 0x85, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa,
+     0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0x55, 0x95, 0x59, 0x65,
+     0x55, 0x55, 0x55, 0x65, 0x55, 0x55, 0xa5, 0xaa, 0x55, 0x55, 0x55, 0x55,
+     0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x15, 0x15, 0x00, 0x80, 0xaa,
+     0x55, 0x55, 0xa5, 0xaa},
+    {0x50, 0x56, 0x55, 0x69, 0x69, 0x55, 0x55, 0x55, 0x55, 0x55, 0x59, 0x55,
+     0x59, 0x56, 0x25, 0x54, 0x54, 0x69, 0x69, 0xa5, 0xa9, 0x6a, 0xaa, 0x56,
+     0x55, 0x0a, 0x00, 0xa8, 0x00, 0xa8, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa,
+     0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa,
+     0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa,
+     0xaa, 0xaa, 0xaa, 0xaa},
+    {0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+     0x55, 0x55, 0x00, 0x00, 0x05, 0x44, 0x55, 0x55, 0x55, 0x55, 0x55, 0x46,
+     0xa5, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0x55, 0x55, 0x55, 0x55,
+     0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x15, 0x00, 0x44, 0x15,
+     0x04, 0x55, 0xaa, 0xaa, 0x55, 0x55, 0xa5, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa,
+     0xaa, 0xaa, 0xaa, 0xaa},
+    {0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa,
+     0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa,
+     0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0x55, 0x55, 0x55, 0x55,
+     0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x05, 0xa0, 0x55, 0x10,
+     0x54, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0xa0, 0xaa, 0xaa, 0xaa, 0xaa,
+     0xaa, 0xaa, 0xaa, 0xaa},
+    {0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+     0x15, 0x00, 0x40, 0x11, 0x54, 0xa9, 0xaa, 0xaa, 0x55, 0x55, 0xa5, 0xaa,
+     0x55, 0x55, 0x55, 0xa9, 0xaa, 0xaa, 0xaa, 0xaa, 0x55, 0x55, 0x55, 0x55,
+     0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x15, 0x51, 0x00, 0x10, 0xa5, 0xaa,
+     0x55, 0x55, 0xa5, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa,
+     0xaa, 0xaa, 0xaa, 0xaa},
+    {0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x95, 0x02, 0x05, 0x10, 0x00, 0xaa,
+     0x55, 0x55, 0x55, 0x55, 0x55, 0x95, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa,
+     0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa,
+     0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa,
+     0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa,
+     0xaa, 0xaa, 0xaa, 0xaa},
+    {0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x15,
+     0x00, 0x00, 0x41, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa,
+     0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa,
+     0xaa, 0xaa, 0xaa, 0xaa, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+     0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+     0x95, 0xaa, 0xaa, 0x6a},
+    {0x55, 0x95, 0xa6, 0x55, 0x55, 0x96, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+     0x55, 0x65, 0x29, 0x44, 0x15, 0x95, 0xaa, 0xaa, 0x55, 0x55, 0xa5, 0xaa,
+     0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa,
+     0xaa, 0xaa, 0xaa, 0xaa, 0x55, 0x55, 0x5a, 0x55, 0x55, 0x55, 0x55, 0x55,
+     0x55, 0x55, 0x55, 0x55, 0x55, 0x00, 0x0a, 0x55, 0x54, 0xa9, 0xaa, 0xaa,
+     0xaa, 0xaa, 0xaa, 0xaa},
+    {0x01, 0x00, 0x40, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+     0x15, 0x00, 0x14, 0x40, 0x55, 0x15, 0xaa, 0xaa, 0x01, 0x40, 0x01, 0x55,
+     0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x05, 0x00,
+     0x00, 0x40, 0x50, 0x55, 0x95, 0xaa, 0xaa, 0xaa, 0x55, 0x55, 0x55, 0x55,
+     0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+     0x55, 0x55, 0xa9, 0xaa},
+    {0x55, 0x55, 0x59, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+     0x00, 0x80, 0x00, 0x10, 0x55, 0xa5, 0xaa, 0xaa, 0x55, 0x55, 0x55, 0x55,
+     0x55, 0x55, 0x55, 0xa9, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+     0x0a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x00, 0x04, 0x81, 0xaa, 0xaa,
+     0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa,
+     0xaa, 0xaa, 0xaa, 0xaa},
+    {0x55, 0x95, 0x65, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+     0x01, 0x80, 0x8a, 0x20, 0x00, 0x10, 0xaa, 0xaa, 0x55, 0x55, 0xa5, 0xaa,
+     0x55, 0x65, 0x59, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x95,
+     0x60, 0x11, 0xa9, 0xaa, 0x55, 0x55, 0xa5, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa,
+     0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa,
+     0xaa, 0xaa, 0xaa, 0xaa},
+    {0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa,
+     0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa,
+     0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa,
+     0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa,
+     0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0x55, 0x55, 0x55, 0x55,
+     0x15, 0x54, 0xa9, 0xaa},
+    {0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa,
+     0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa,
+     0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa,
+     0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xa9, 0xaa, 0xaa, 0xaa,
+     0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+     0xa5, 0xaa, 0xaa, 0x6a},
+    {0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+     0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+     0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+     0x55, 0x55, 0xa5, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa,
+     0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa,
+     0xaa, 0xaa, 0xaa, 0xaa},
+    {0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+     0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+     0x55, 0x55, 0x55, 0x95, 0x55, 0xa9, 0xaa, 0xaa, 0x55, 0x55, 0x55, 0x55,
+     0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+     0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+     0x55, 0x55, 0x55, 0x55},
+    {0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+     0x55, 0x55, 0x55, 0x55, 0x55, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa,
+     0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa,
+     0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa,
+     0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa,
+     0xaa, 0xaa, 0xaa, 0xaa},
+    {0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa,
+     0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa,
+     0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa,
+     0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+     0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+     0x95, 0xaa, 0xaa, 0xaa},
+    {0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x95,
+     0x00, 0x00, 0xa8, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa,
+     0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa,
+     0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa,
+     0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa,
+     0xaa, 0xaa, 0xaa, 0xaa},
+    {0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+     0x55, 0x55, 0x55, 0x55, 0x55, 0x95, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa,
+     0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa,
+     0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa,
+     0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa,
+     0xaa, 0xaa, 0xaa, 0xaa},
+    {0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+     0x55, 0x55, 0xa9, 0xaa, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x95,
+     0x55, 0x55, 0xa5, 0x5a, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+     0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x95,
+     0x55, 0x55, 0xa5, 0xaa, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0xa5,
+     0x00, 0xa4, 0xaa, 0xaa},
+    {0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+     0x00, 0x40, 0x55, 0x55, 0x55, 0xa5, 0xaa, 0xaa, 0x55, 0x55, 0x65, 0x55,
+     0x65, 0x55, 0x55, 0x55, 0x55, 0x55, 0xaa, 0x56, 0x55, 0x55, 0x55, 0x55,
+     0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa,
+     0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa,
+     0xaa, 0xaa, 0xaa, 0xaa},
+    {0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa,
+     0xaa, 0xaa, 0xaa, 0xaa, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+     0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+     0x55, 0x55, 0x95, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa,
+     0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa,
+     0xaa, 0xaa, 0xaa, 0xaa},
+    {0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+     0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x95, 0x2a, 0x55, 0x55, 0x55, 0x55,
+     0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0xaa, 0x2a,
+     0x40, 0x55, 0x55, 0x55, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa,
+     0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xa8, 0xaa, 0xaa,
+     0xaa, 0xaa, 0xaa, 0xaa},
+    {0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+     0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+     0x55, 0x55, 0x95, 0xaa, 0x55, 0x55, 0x55, 0xa9, 0x55, 0x55, 0xa9, 0xaa,
+     0x55, 0x55, 0xa5, 0x41, 0x00, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa,
+     0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa,
+     0xaa, 0xaa, 0xaa, 0xaa},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa0,
+     0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0xaa, 0xaa, 0x55, 0x55, 0x55, 0x55,
+     0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+     0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+     0x55, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa,
+     0xaa, 0xaa, 0xaa, 0xaa},
+    {0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+     0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+     0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+     0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+     0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+     0x55, 0xa5, 0xaa, 0xaa},
+    {0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x95, 0x56, 0x55,
+     0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+     0x55, 0x15, 0x50, 0x55, 0x15, 0x00, 0x00, 0x00, 0x40, 0x01, 0x00, 0x55,
+     0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x05, 0x50, 0x55, 0x55, 0x55, 0x55,
+     0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x95, 0xaa,
+     0xaa, 0xaa, 0xaa, 0xaa},
+    {0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+     0x55, 0x55, 0x55, 0x55, 0x05, 0xa4, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa,
+     0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa,
+     0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa,
+     0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0x55, 0x55, 0x55, 0x55,
+     0x55, 0xaa, 0xaa, 0xaa},
+    {0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+     0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x95, 0xaa, 0xaa,
+     0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0xa9, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa,
+     0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa,
+     0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa,
+     0xaa, 0xaa, 0xaa, 0xaa},
+    {0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+     0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x59, 0x55, 0x55,
+     0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+     0x55, 0x55, 0x55, 0x59, 0x9a, 0x96, 0x56, 0x59, 0x55, 0x55, 0x65, 0x56,
+     0x55, 0x56, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+     0x55, 0x55, 0x55, 0x55},
+    {0x55, 0x65, 0x95, 0x56, 0x55, 0x59, 0x55, 0x59, 0x55, 0x55, 0x55, 0x55,
+     0x55, 0x55, 0x65, 0x95, 0x55, 0x99, 0x5a, 0x55, 0x59, 0x55, 0x55, 0x55,
+     0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+     0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+     0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+     0x55, 0x55, 0x55, 0x55},
+    {0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+     0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+     0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+     0x55, 0x55, 0x55, 0x55, 0x55, 0xa5, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+     0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+     0x55, 0x55, 0x55, 0x55},
+    {0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+     0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+     0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+     0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+     0x55, 0x55, 0x55, 0x5a, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+     0x55, 0x55, 0x55, 0x55},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+     0x00, 0x40, 0x15, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+     0x00, 0x00, 0x00, 0x54, 0x55, 0x51, 0x55, 0x55, 0x55, 0x54, 0x55, 0xaa,
+     0xaa, 0xaa, 0x2a, 0x00, 0x02, 0x00, 0x00, 0x00, 0xaa, 0xaa, 0xaa, 0xaa,
+     0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa,
+     0xaa, 0xaa, 0xaa, 0xaa},
+    {0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x95, 0xaa, 0xaa, 0xaa, 0xaa,
+     0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa,
+     0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa,
+     0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa,
+     0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa,
+     0xaa, 0xaa, 0xaa, 0xaa},
+    {0x00, 0x80, 0x00, 0x00, 0x00, 0x00, 0x28, 0x00, 0x20, 0x08, 0x80, 0xaa,
+     0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa,
+     0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa,
+     0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa,
+     0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa,
+     0xaa, 0xaa, 0xaa, 0xaa},
+    {0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0xa9,
+     0x00, 0x40, 0x55, 0xa5, 0x55, 0x55, 0xa5, 0x5a, 0xaa, 0xaa, 0xaa, 0xaa,
+     0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa,
+     0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa,
+     0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa,
+     0xaa, 0xaa, 0xaa, 0xaa},
+    {0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa,
+     0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa,
+     0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa,
+     0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x85, 0xaa, 0xaa, 0xaa, 0xaa,
+     0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x00,
+     0x55, 0x55, 0xa5, 0x6a},
+    {0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa,
+     0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa,
+     0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa,
+     0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa,
+     0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0x55, 0x95, 0x55, 0x96,
+     0x55, 0x55, 0x55, 0x95},
+    {0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+     0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+     0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+     0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+     0x55, 0x69, 0x55, 0x55, 0x00, 0x80, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa,
+     0xaa, 0xaa, 0xaa, 0xaa},
+    {0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+     0x55, 0x55, 0x55, 0x55, 0x55, 0x00, 0x40, 0xaa, 0x55, 0x55, 0xa5, 0x5a,
+     0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa,
+     0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa,
+     0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa,
+     0xaa, 0xaa, 0xaa, 0xaa},
+    {0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa,
+     0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa,
+     0xaa, 0xaa, 0xaa, 0xaa, 0x56, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+     0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0xa9, 0xaa, 0xaa,
+     0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa,
+     0xaa, 0xaa, 0xaa, 0xaa},
+    {0x56, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+     0x55, 0x55, 0x55, 0xa5, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa,
+     0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa,
+     0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa,
+     0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa,
+     0xaa, 0xaa, 0xaa, 0xaa},
+    {0x55, 0x56, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x96, 0x69, 0x56, 0x55,
+     0x95, 0x55, 0x66, 0xaa, 0x9a, 0x6a, 0x66, 0x56, 0x96, 0x69, 0x66, 0x66,
+     0x96, 0x69, 0x95, 0x55, 0x95, 0x55, 0x56, 0x99, 0x55, 0x55, 0x65, 0x55,
+     0x55, 0x55, 0x55, 0xaa, 0x56, 0x56, 0x65, 0x55, 0x55, 0x55, 0x55, 0xaa,
+     0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa,
+     0xa5, 0xaa, 0xaa, 0xaa},
+    {0x55, 0x56, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0xaa,
+     0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+     0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+     0x55, 0xaa, 0xaa, 0xaa, 0x55, 0x55, 0x55, 0x95, 0x56, 0x55, 0x55, 0x55,
+     0x56, 0x55, 0x55, 0x95, 0x56, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+     0x55, 0xa5, 0xaa, 0xaa},
+    {0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+     0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+     0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x65,
+     0xa9, 0xaa, 0x6a, 0x55, 0x55, 0x55, 0x55, 0xa5, 0xaa, 0xaa, 0xaa, 0xaa,
+     0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0x5a, 0x55, 0x55,
+     0x55, 0x55, 0x55, 0x55},
+    {0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0x56, 0x55, 0x55, 0xa9,
+     0xaa, 0x9a, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa,
+     0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xa6, 0xaa, 0xaa, 0xaa, 0xaa,
+     0xaa, 0x55, 0x55, 0x55, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa,
+     0xaa, 0xaa, 0x6a, 0x95, 0xaa, 0x55, 0x55, 0x55, 0xaa, 0xaa, 0xaa, 0xaa,
+     0x56, 0x56, 0xaa, 0xaa},
+    {0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa,
+     0xaa, 0xaa, 0xaa, 0x6a, 0xa6, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa,
+     0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa,
+     0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa,
+     0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa,
+     0xaa, 0xaa, 0xaa, 0x96},
+    {0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa,
+     0xaa, 0xaa, 0xaa, 0x5a, 0x55, 0x55, 0x95, 0x6a, 0xaa, 0xaa, 0xaa, 0xaa,
+     0xaa, 0xaa, 0x55, 0x55, 0x55, 0x55, 0x65, 0x55, 0x55, 0x55, 0x55, 0x55,
+     0x55, 0x69, 0x55, 0x55, 0x55, 0x56, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+     0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+     0x55, 0x55, 0x95, 0xaa},
+    {0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa,
+     0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0x55, 0x55, 0x55, 0x55,
+     0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0xaa, 0xaa, 0xaa, 0xaa,
+     0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa,
+     0xaa, 0x5a, 0x55, 0x56, 0x6a, 0xa9, 0xaa, 0xaa, 0x55, 0x55, 0x95, 0xaa,
+     0x55, 0xaa, 0xaa, 0xaa},
+    {0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+     0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+     0x55, 0x55, 0x55, 0x55, 0x55, 0xaa, 0xaa, 0xaa, 0x55, 0x55, 0x55, 0x55,
+     0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+     0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0xa9, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa,
+     0xaa, 0xaa, 0xaa, 0xaa},
+    {0x55, 0x55, 0x55, 0xaa, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+     0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0xaa, 0xaa, 0x55, 0x55, 0xa5, 0xaa,
+     0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0xaa, 0xaa,
+     0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0xa5, 0xa5, 0xaa, 0xaa, 0xaa,
+     0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa,
+     0xaa, 0xaa, 0xaa, 0xaa},
+    {0x55, 0x55, 0x55, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa,
+     0xaa, 0xaa, 0x6a, 0xaa, 0xaa, 0x9a, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa,
+     0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa,
+     0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa,
+     0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa,
+     0xaa, 0xaa, 0xaa, 0xaa},
+    {0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+     0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0xaa, 0xaa, 0xaa,
+     0x55, 0x55, 0x55, 0xa5, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa,
+     0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa,
+     0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa,
+     0xaa, 0xaa, 0xaa, 0xaa},
+    {0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+     0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+     0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+     0x95, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+     0x55, 0x55, 0x95, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa,
+     0x55, 0x55, 0xa5, 0xaa},
+    {0xa2, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0x00, 0x00, 0x00, 0x00,
+     0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+     0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xaa, 0xaa, 0xaa, 0xaa,
+     0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa,
+     0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa,
+     0xaa, 0xaa, 0xaa, 0xaa},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+     0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+     0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+     0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+     0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+     0xaa, 0xaa, 0xaa, 0xaa},
+    {0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+     0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+     0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+     0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+     0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+     0x55, 0x55, 0x55, 0xa5},
+};
+// END ucd2width.py
+
+// Returns the number of cells (0, 1 or 2) a codepoint is drawn in.
+static inline int get_codepoint_width(Uint32 cp) {
+  if (cp < 0x300) {
+    return 1;
+  }
+  if (cp > 0x10ffff) {
+    return 1;
+  }
+  const Uint8* block = width_blocks[width_index[cp >> 8]];
+  return (block[(cp & 0xff) >> 2] >> ((cp & 3) * 2)) & 3;
+}
+
+int DBGP_GetCodepointWidth(Uint32 cp) {
+  return get_codepoint_width(cp);
+}
+
+#define BATCH_MAX_QUADS 128
+#define BATCH_MAX_TEXTURES 4
+// the larger batches of DBGP_RenderCells
+#define BATCH_MAX_CELL_QUADS 1024
+
+// Quads drawn with a single SDL_RenderGeometry call (texture is NULL for
+// backgrounds)
+typedef struct {
+  SDL_Texture* texture;
+  int nb_quads;
+  SDL_Vertex* vertices; // max_quads * 4 vertices, in the frame arena
+} quad_batch;
+
+// The backgrounds and glyphs of the text being drawn, grouped by texture.
+// Backgrounds are always flushed before the glyphs queued after them.
+typedef struct {
+  SDL_Renderer* renderer;
+  bool open; // opened by DBGP_BeginBatch: draw calls add to it
+  quad_batch bg;
+  quad_batch fg[BATCH_MAX_TEXTURES];
+  int nb_fg;
+  int max_quads; // the capacity of each quad batch
+  int max_textures; // the number of glyph quad batches
+  const int* indices; // the indices of max_quads quads
+  arena_mark mark;
+} glyph_batch;
+
+static glyph_batch batch;
+
+static bool is_batch_open(void) {
+  return batch.open;
+}
+static int quad_indices[BATCH_MAX_CELL_QUADS * 6];
+
+// Fills the indices of the two triangles of nb_quads quads.
+static void fill_quad_indices(int* indices, int nb_quads) {
+  for (int i = 0; i < nb_quads; i++) {
+    indices[i * 6 + 0] = i * 4 + 0;
+    indices[i * 6 + 1] = i * 4 + 1;
+    indices[i * 6 + 2] = i * 4 + 2;
+    indices[i * 6 + 3] = i * 4 + 0;
+    indices[i * 6 + 4] = i * 4 + 2;
+    indices[i * 6 + 5] = i * 4 + 3;
+  }
+}
+
+// Starts a batch of max_quads quads per texture, for up to max_textures
+// glyph textures at once. Batches larger than BATCH_MAX_CELL_QUADS have their
+// own indices, in the frame arena.
+static bool begin_sized_batch(
+    SDL_Renderer* renderer, int max_quads, int max_textures) {
+  if (batch.open) {
+    if (batch.renderer != renderer) {
+      return SDL_SetError("A batch is open on another renderer");
+    }
+    return true;
+  }
+  if (quad_indices[1] == 0) {
+    fill_quad_indices(quad_indices, BATCH_MAX_CELL_QUADS);
+  }
+  batch.renderer = renderer;
+  batch.bg.nb_quads = 0;
+  batch.nb_fg = 0;
+  batch.max_quads = max_quads;
+  batch.max_textures = max_textures;
+  batch.mark = get_arena_mark();
+
+  const size_t size = max_quads * 4 * sizeof(SDL_Vertex);
+  batch.bg.vertices = arena_alloc(size);
+  bool result = batch.bg.vertices != NULL;
+  batch.indices = quad_indices;
+  if (result && max_quads > BATCH_MAX_CELL_QUADS) {
+    int* indices = arena_alloc(max_quads * 6 * sizeof(int));
+    if (indices != NULL) {
+      fill_quad_indices(indices, max_quads);
+    }
+    batch.indices = indices;
+    result = indices != NULL;
+  }
+  for (int i = 0; i < max_textures && result; i++) {
+    batch.fg[i].vertices = arena_alloc(size);
+    result = batch.fg[i].vertices != NULL;
+  }
+  if (!result) {
+    release_arena(batch.mark);
+  }
+  return result;
+}
+
+static inline bool begin_batch(SDL_Renderer* renderer) {
+  return begin_sized_batch(renderer, BATCH_MAX_QUADS, BATCH_MAX_TEXTURES);
+}
+
+static void flush_quads(quad_batch* quads) {
+  if (quads->nb_quads > 0) {
+    SDL_RenderGeometry(
+        batch.renderer, quads->texture, quads->vertices, quads->nb_quads * 4,
+        batch.indices, quads->nb_quads * 6);
+    quads->nb_quads = 0;
+  }
+}
+
+static void flush_batch(void) {
+  flush_quads(&batch.bg);
+  for (int i = 0; i < batch.nb_fg; i++) {
+    flush_quads(&batch.fg[i]);
+  }
+  batch.nb_fg = 0;
+}
+
+// Flushes the batch and releases its memory, unless it was opened by
+// DBGP_BeginBatch.
+static void end_batch(void) {
+  if (!batch.open) {
+    flush_batch();
+    release_arena(batch.mark);
+  }
+}
+
+bool DBGP_BeginBatch(SDL_Renderer* renderer) {
+  if (renderer == NULL) {
+    return false;
+  }
+  if (batch.open) {
+    return SDL_SetError("A batch is already open");
+  }
+  if (!begin_batch(renderer)) {
+    return false;
+  }
+  batch.open = true;
+  return true;
+}
+
+bool DBGP_EndBatch(SDL_Renderer* renderer) {
+  if (!batch.open || batch.renderer != renderer) {
+    return SDL_SetError("No batch is open on this renderer");
+  }
+  batch.open = false;
+  end_batch();
+  return true;
+}
+
+// Adds a quad; src (in texture coordinates) is NULL for untextured quads.
+static inline void add_quad(
+    quad_batch* quads, float x, float y, float w, float h,
+    const SDL_FRect* src, SDL_FColor color) {
+  SDL_Vertex* v = &quads->vertices[quads->nb_quads++ * 4];
+  v[0].position.x = x;
+  v[0].position.y = y;
+  v[1].position.x = x + w;
+  v[1].position.y = y;
+  v[2].position.x = x + w;
+  v[2].position.y = y + h;
+  v[3].position.x = x;
+  v[3].position.y = y + h;
+  for (int i = 0; i < 4; i++) {
+    v[i].color = color;
+  }
+  if (src != NULL) {
+    v[0].tex_coord.x = v[3].tex_coord.x = src->x;
+    v[1].tex_coord.x = v[2].tex_coord.x = src->x + src->w;
+    v[0].tex_coord.y = v[1].tex_coord.y = src->y;
+    v[2].tex_coord.y = v[3].tex_coord.y = src->y + src->h;
+  }
+}
+
+// The caller arrays DBGP_BuildGeometry writes quads into instead of queueing
+// them. The text drawing functions take one, or NULL to queue the quads.
+typedef struct {
+  const DBGP_Font* font;
+  SDL_Vertex* vertices;
+  int* indices;
+  int max_quads;
+  int nb_quads; // the number of quads of the text, written or not
+  int columns; // the number of cells per line of the atlas pixels
+  float width; // the size of the atlas pixels
+  float height;
+} geometry_output;
+
+// Returns the number of cells per line of the atlas of
+// DBGP_GetFontAtlasPixels: the glyphs of the font and a white cell for
+// backgrounds, in a grid about as wide as high.
+static int get_geometry_columns(const DBGP_Font* font) {
+  const unsigned int nb_cells = font->nb_glyphs + 1;
+  const Uint64 area = (Uint64) nb_cells * font->glyph_width *
+                      font->glyph_height;
+  unsigned int columns = 1;
+  while (columns < nb_cells &&
+         (Uint64) columns * columns * font->glyph_width * font->glyph_width <
+             area) {
+    columns++;
+  }
+  return (int) columns;
+}
+
+// Adds a quad to the geometry output if it fits, with the texture
+// coordinates of a cell of the atlas pixels (the whole cell for glyphs, its
+// center for backgrounds).
+static void add_geometry_quad(
+    geometry_output* out, float x, float y, float w, float h, unsigned int cell,
+    bool fill, SDL_FColor color) {
+  if (out->vertices != NULL && out->nb_quads < out->max_quads) {
+    const float cell_w = out->font->glyph_width;
+    const float cell_h = out->font->glyph_height;
+    SDL_FRect src = {
+        cell % out->columns * cell_w, cell / out->columns * cell_h, cell_w,
+        cell_h};
+    if (fill) {
+      src.x += cell_w / 2;
+      src.y += cell_h / 2;
+      src.w = src.h = 0;
+    }
+    src.x /= out->width;
+    src.y /= out->height;
+    src.w /= out->width;
+    src.h /= out->height;
+
+    quad_batch quads = {NULL, out->nb_quads, out->vertices};
+    add_quad(&quads, x, y, w, h, &src, color);
+    int* index = &out->indices[out->nb_quads * 6];
+    const int first = out->nb_quads * 4;
+    index[0] = first + 0;
+    index[1] = first + 1;
+    index[2] = first + 2;
+    index[3] = first + 0;
+    index[4] = first + 2;
+    index[5] = first + 3;
+  }
+  out->nb_quads++;
+}
+
+// Queues a filled rectangle, drawn with the backgrounds.
+static inline void draw_rect(
+    float x, float y, float w, float h, SDL_FColor color) {
+  if (batch.bg.nb_quads == batch.max_quads) {
+    flush_quads(&batch.bg);
+  }
+  add_quad(&batch.bg, x, y, w, h, NULL, color);
+}
+
+// Queues a glyph of a font (not one of its fallbacks) drawn with a style, the
+// glyph itself at (x, y).
+static inline void queue_glyph(
+    const DBGP_Font* font, int style, Uint32 glyph, float x, float y,
+    SDL_FColor color) {
+  const DBGP_FontAtlas* atlas = get_style_atlas(font, style);
+  SDL_FRect src;
+  SDL_Texture* tex = get_glyph_source(atlas, glyph, &src);
+
+  quad_batch* quads = NULL;
+  for (int i = 0; i < batch.nb_fg; i++) {
+    if (batch.fg[i].texture == tex) {
+      quads = &batch.fg[i];
+      break;
+    }
+  }
+  if (quads == NULL) {
+    if (batch.nb_fg == batch.max_textures) {
+      flush_batch();
+    }
+    quads = &batch.fg[batch.nb_fg++];
+    quads->texture = tex;
+    quads->nb_quads = 0;
+  } else if (quads->nb_quads == batch.max_quads) {
+    flush_quads(&batch.bg);
+    flush_quads(quads);
+  }
+
+  const float w = src.w;
+  const float h = src.h;
+  src.x /= atlas->width;
+  src.y /= atlas->height;
+  src.w /= atlas->width;
+  src.h /= atlas->height;
+  add_quad(quads, x - atlas->glyph_x, y - atlas->glyph_y, w, h, &src, color);
+}
+
+// Adds the background of a glyph to out, or queues it if out is NULL.
+static inline void draw_background(
+    geometry_output* out, float x, float y, float w, float h,
+    SDL_FColor color) {
+  if (out != NULL) {
+    add_geometry_quad(out, x, y, w, h, out->font->nb_glyphs, true, color);
+    return;
+  }
+  draw_rect(x, y, w, h, color);
+}
+
+// Queues a glyph of owner, as returned by resolve_glyph for font, or adds it
+// to out if it isn't NULL (nothing is drawn when owner is NULL).
+static inline void draw_resolved_glyph(
+    geometry_output* out, const DBGP_Font* font, const DBGP_Font* owner,
+    Uint32 glyph, float x, float y, SDL_FColor fg_color) {
+  if (out != NULL) {
+    // the atlas pixels only hold the glyphs of the font
+    if (owner == out->font) {
+      add_geometry_quad(
+          out, x, y, font->glyph_width, font->glyph_height, glyph, false,
+          fg_color);
+    }
+    return;
+  }
+  if (owner == NULL || owner->atlas.nb_pages == 0) {
+    return;
+  }
+  queue_glyph(owner, font->style, glyph, x, y, fg_color);
+}
+
+// Queues the background (unless bg_color is NULL) and the glyph of a
+// codepoint, drawn from font or one of its fallbacks, or adds them to out if
+// it isn't NULL.
+static inline void draw_glyph(
+    geometry_output* out, DBGP_Font* font, float x, float y, Uint32 cp,
+    const SDL_FColor* bg_color, SDL_FColor fg_color) {
+  if (bg_color != NULL) {
+    draw_background(
+        out, x, y, font->glyph_width, font->glyph_height, *bg_color);
+  }
+
+  Uint32 glyph = 0;
+  const DBGP_Font* owner = resolve_glyph(font, cp, &glyph);
+  draw_resolved_glyph(out, font, owner, glyph, x, y, fg_color);
+}
+
+static inline bool is_wide_glyph(const DBGP_Font* font, Uint32 glyph) {
+  return font->wide_glyphs != NULL &&
+         (font->wide_glyphs[glyph / 8] >> (glyph % 8) & 1);
+}
+
+// Queues a codepoint of text, in as many cells as its width, and returns the
+// number of pixels to advance by. prev_width is the width of the codepoint
+// drawn just before x (0 at the start of a line or after the cursor moved),
+// and is updated. Zero-width codepoints (combining marks) are drawn without
+// background at the start of that codepoint, over both cells of a wide one,
+// and skipped when there is none. Wide codepoints are drawn with both halves
+// of a wide glyph, or with a narrow glyph on the left of their two cells.
+static inline int draw_text_glyph(
+    geometry_output* out, DBGP_Font* font, float x, float y, int* prev_width,
+    Uint32 cp, const SDL_FColor* bg_color, SDL_FColor fg_color) {
+  const int width = get_codepoint_width(cp);
+  if (width == 0) {
+    if (*prev_width > 0) {
+      draw_glyph(
+          out, font, x - *prev_width * font->glyph_width, y, cp, NULL,
+          fg_color);
+    }
+    return 0;
+  }
+  *prev_width = width;
+  if (width == 1) {
+    draw_glyph(out, font, x, y, cp, bg_color, fg_color);
+    return font->glyph_width;
+  }
+
+  if (bg_color != NULL) {
+    draw_background(
+        out, x, y, 2 * font->glyph_width, font->glyph_height, *bg_color);
+  }
+  Uint32 glyph = 0;
+  const DBGP_Font* owner = resolve_glyph(font, cp, &glyph);
+  draw_resolved_glyph(out, font, owner, glyph, x, y, fg_color);
+  if (owner != NULL && is_wide_glyph(owner, glyph)) {
+    draw_resolved_glyph(
+        out, font, owner, glyph + 1, x + font->glyph_width, y, fg_color);
+  }
+  return 2 * font->glyph_width;
+}
+
+static inline SDL_FColor to_fcolor(SDL_Color color) {
+  SDL_FColor fcolor = {
+      color.r / 255.0f, color.g / 255.0f, color.b / 255.0f, color.a / 255.0f};
+  return fcolor;
+}
+
+enum {
+  OVERLAY_PRINT,
+  OVERLAY_COLOR_PRINT,
+  OVERLAY_PRINT_WRAPPED,
+};
+
+// A print call recorded by an overlay cache, followed by its string
+typedef struct {
+  DBGP_Font* font;
+  Uint32 length; // the length of the string, without its NULL character
+  Uint8 type;
+  Uint8 colors;
+  Uint16 flags;
+  int style; // the style of the font when the call was recorded
+  SDL_Rect box; // position (and box of DBGP_PrintWrapped)
+  SDL_Color bg_color;
+  SDL_Color fg_color;
+} overlay_command;
+
+// The overlay cache recording print calls (see DBGP_BeginOverlayCache)
+static DBGP_OverlayCache* recording_overlay = NULL;
+
+static inline bool is_recording(SDL_Renderer* renderer) {
+  return recording_overlay != NULL && recording_overlay->renderer == renderer;
+}
+
+// Fails if an overlay cache is recording on the renderer, for the drawing
+// functions it can't record: their text would be drawn under the cache
+// texture, and would not be part of its hash.
+static inline bool check_not_recording(SDL_Renderer* renderer) {
+  if (is_recording(renderer)) {
+    return SDL_SetError("Can't be drawn while an overlay cache is recording");
+  }
+  return true;
+}
+
+static bool record_overlay_command(overlay_command* command, const char* str);
+
+// The trace being written (see DBGP_StartTrace)
+typedef struct {
+  SDL_IOStream* stream;
+  bool closeio;
+  bool failed; // a write failed: nothing is written anymore
+  Uint8* buffer; // DBGP_TRACE_BUFFER_SIZE bytes
+  size_t size;
+  const DBGP_Font** fonts; // the font of each id
+  int nb_fonts;
+  int fonts_capacity;
+} trace_writer;
+
+static trace_writer trace;
+
+static inline bool is_tracing(void) {
+  return trace.stream != NULL;
+}
+
+static void flush_trace(void) {
+  if (trace.size > 0 && !trace.failed &&
+      SDL_WriteIO(trace.stream, trace.buffer, trace.size) != trace.size) {
+    trace.failed = true;
+  }
+  trace.size = 0;
+}
+
+static void write_trace(const void* data, size_t len) {
+  if (trace.size + len > DBGP_TRACE_BUFFER_SIZE) {
+    flush_trace();
+  }
+  if (len > DBGP_TRACE_BUFFER_SIZE) {
+    if (!trace.failed && SDL_WriteIO(trace.stream, data, len) != len) {
+      trace.failed = true;
+    }
+    return;
+  }
+  SDL_memcpy(trace.buffer + trace.size, data, len);
+  trace.size += len;
+}
+
+static void write_trace_uint(Uint64 value) {
+  Uint8 bytes[10];
+  int len = 0;
+  do {
+    bytes[len] = value & 0x7f;
+    value >>= 7;
+    bytes[len++] |= value != 0 ? 0x80 : 0;
+  } while (value != 0);
+  write_trace(bytes, len);
+}
+
+static inline void write_trace_int(Sint64 value) {
+  write_trace_uint(
+      value < 0 ? (Uint64) ~value << 1 | 1 : (Uint64) value << 1);
+}
+
+static inline void write_trace_byte(Uint8 value) {
+  write_trace(&value, 1);
+}
+
+// Returns the id of a font in the trace, describing the font the first time.
+static Uint32 get_trace_font(const DBGP_Font* font) {
+  for (int i = 0; i < trace.nb_fonts; i++) {
+    if (trace.fonts[i] == font) {
+      return i;
+    }
+  }
+  if (trace.nb_fonts == trace.fonts_capacity) {
+    const int capacity = SDL_max(trace.fonts_capacity * 2, 8);
+    const DBGP_Font** fonts =
+        mem_realloc(trace.fonts, capacity * sizeof(DBGP_Font*));
+    if (fonts == NULL) {
+      trace.failed = true;
+      return 0;
+    }
+    trace.fonts = fonts;
+    trace.fonts_capacity = capacity;
+  }
+  trace.fonts[trace.nb_fonts] = font;
+  write_trace_byte(DBGP_TRACE_FONT);
+  write_trace_uint(trace.nb_fonts);
+  write_trace_uint(font->glyph_height);
+  write_trace_uint(font->nb_glyphs);
+  return trace.nb_fonts++;
+}
+
+// Writes a print call (after formatting) into the trace.
+static void trace_command(const overlay_command* command, const char* str) {
+  if (!is_tracing() || trace.failed) {
+    return;
+  }
+  const Uint32 font = get_trace_font(command->font);
+  switch (command->type) {
+  case OVERLAY_PRINT:
+    write_trace_byte(DBGP_TRACE_PRINT);
+    write_trace_uint(font);
+    write_trace_int(command->box.x);
+    write_trace_int(command->box.y);
+    write_trace(&command->bg_color, 4);
+    write_trace(&command->fg_color, 4);
+    break;
+  case OVERLAY_COLOR_PRINT:
+    write_trace_byte(DBGP_TRACE_COLOR_PRINT);
+    write_trace_uint(font);
+    write_trace_int(command->box.x);
+    write_trace_int(command->box.y);
+    write_trace_byte(command->colors);
+    break;
+  case OVERLAY_PRINT_WRAPPED:
+    write_trace_byte(DBGP_TRACE_PRINT_WRAPPED);
+    write_trace_uint(font);
+    write_trace_int(command->box.x);
+    write_trace_int(command->box.y);
+    write_trace_int(command->box.w);
+    write_trace_int(command->box.h);
+    write_trace_byte(command->colors);
+    write_trace_uint(command->flags);
+    break;
+  }
+  const size_t len = str != NULL ? SDL_strlen(str) : 0;
+  write_trace_uint(len);
+  write_trace(str, len);
+}
+
+bool DBGP_StartTrace(SDL_IOStream* dst, bool closeio) {
+  if (dst == NULL) {
+    return false;
+  }
+  if (is_tracing()) {
+    if (closeio) {
+      SDL_CloseIO(dst);
+    }
+    return SDL_SetError("A trace is already being written");
+  }
+  SDL_memset(&trace, 0, sizeof(trace));
+  trace.buffer = mem_malloc(DBGP_TRACE_BUFFER_SIZE);
+  if (trace.buffer == NULL) {
+    if (closeio) {
+      SDL_CloseIO(dst);
+    }
+    return false;
+  }
+  trace.stream = dst;
+  trace.closeio = closeio;
+  const Uint8 header[5] = {'D', 'B', 'G', 'T', DBGP_TRACE_VERSION};
+  write_trace(header, sizeof(header));
+  return true;
+}
+
+bool DBGP_TraceFrame(void) {
+  if (!is_tracing()) {
+    return false;
+  }
+  write_trace_byte(DBGP_TRACE_FRAME);
+  flush_trace();
+  return !trace.failed || SDL_SetError("Unable to write trace");
+}
+
+bool DBGP_StopTrace(void) {
+  if (!is_tracing()) {
+    return false;
+  }
+  flush_trace();
+  bool result = !trace.failed;
+  if (trace.closeio && !SDL_CloseIO(trace.stream)) {
+    result = false;
+  }
+  mem_free(trace.buffer);
+  mem_free(trace.fonts);
+  SDL_memset(&trace, 0, sizeof(trace));
+  return result || SDL_SetError("Unable to write trace");
+}
+
+// Queues the glyphs of a string drawn with DBGP_Print, or adds them to out if
+// it isn't NULL.
+static void print_string(
+    geometry_output* out, DBGP_Font* font, int x, int y, SDL_Color bg_color,
+    SDL_Color fg_color, const char* str) {
+  const SDL_FColor bg = to_fcolor(bg_color);
+  const SDL_FColor fg = to_fcolor(fg_color);
+  const char* ptr = str;
+  int ix = x;
+  int iy = y;
+  int prev_width = 0;
+
+  Uint32 cp = 0;
+  while ((cp = SDL_StepUTF8(&ptr, NULL)) != 0) {
+    if (cp >= 256 && cp == SDL_INVALID_UNICODE_CODEPOINT) {
+      continue;
+    }
+
+    if (cp == '\n') {
+      iy += font->glyph_height;
+      ix = x;
+      prev_width = 0;
+      continue;
+    }
+    ix += draw_text_glyph(out, font, ix, iy, &prev_width, cp, &bg, fg);
+  }
+}
+
+bool DBGP_Print(
+    DBGP_Font* font, SDL_Renderer* renderer, int x, int y, SDL_Color bg_color,
+    SDL_Color fg_color, const char* str) {
+  if (font == NULL || font->tex == NULL || renderer == NULL) {
+    return false;
+  }
+  if (is_tracing() || is_recording(renderer)) {
+    overlay_command command;
+    SDL_memset(&command, 0, sizeof(command));
+    command.type = OVERLAY_PRINT;
+    command.font = font;
+    command.box.x = x;
+    command.box.y = y;
+    command.bg_color = bg_color;
+    command.fg_color = fg_color;
+    trace_command(&command, str);
+    if (is_recording(renderer)) {
+      return record_overlay_command(&command, str);
+    }
+  }
+
+  if (!begin_batch(renderer)) {
+    return false;
+  }
+  print_string(NULL, font, x, y, bg_color, fg_color, str);
+  end_batch();
+
+  return true;
+}
+
+bool DBGP_Printf(
+    DBGP_Font* font, SDL_Renderer* renderer, int x, int y, SDL_Color bg_color,
+    SDL_Color fg_color, const char* fmt, ...) {
+  const arena_mark mark = get_arena_mark();
+  va_list args;
+  va_start(args, fmt);
+  const char* str = format_string(fmt, args);
+  va_end(args);
+
+  const bool result =
+      str != NULL &&
+      DBGP_Print(font, renderer, x, y, bg_color, fg_color, str);
+  release_arena(mark);
+  return result;
+}
+
+static inline bool is_hex(char c) {
+  return (c >= '0' && c <= '9') || (c >= 'a' && c <= 'f') ||
+         (c >= 'A' && c <= 'F');
+}
+
+static inline Uint8 get_hex_value(char c) {
+  if (c >= '0' && c <= '9') {
+    return c - '0';
+  }
+  if (c >= 'a' && c <= 'f') {
+    return c - 'a' + 10;
+  }
+  if (c >= 'A' && c <= 'F') {
+    return c - 'A' + 10;
+  }
+  return 0;
+}
+
+// CGA 16-color palette
+static const Uint32 color_palette[16] = {
+    0x000000, 0x0000aa, 0x00aa00, 0x00aaaa, 0xaa0000, 0xaa00aa,
+    0xaa5500, 0xaaaaaa, 0x555555, 0x5555ff, 0x55ff55, 0x55ffff,
+    0xff5555, 0xff55ff, 0xffff55, 0xffffff,
+};
+
+static inline SDL_FColor get_palette_color(Uint8 index) {
+  const Uint32 rgb = color_palette[index & 0xf];
+  SDL_FColor color = {
+      ((rgb >> 16) & 0xff) / 255.0f, ((rgb >> 8) & 0xff) / 255.0f,
+      (rgb & 0xff) / 255.0f, 1.0f};
+  return color;
+}
+
+// Buffered reads from an SDL_IOStream
+typedef struct {
+  SDL_IOStream* src;
+  size_t pos;
+  size_t len;
+  Uint8 buf[4096];
+} io_reader;
+
+static inline int read_byte(io_reader* reader) {
+  if (reader->pos == reader->len) {
+    reader->len = SDL_ReadIO(reader->src, reader->buf, sizeof(reader->buf));
+    reader->pos = 0;
+    if (reader->len == 0) {
+      return -1;
+    }
+  }
+  return reader->buf[reader->pos++];
+}
+
+static bool read_bytes(io_reader* reader, void* data, size_t len) {
+  Uint8* dst = data;
+  for (size_t i = 0; i < len; i++) {
+    int c = read_byte(reader);
+    if (c < 0) {
+      return false;
+    }
+    if (dst != NULL) {
+      dst[i] = (Uint8) c;
+    }
+  }
+  return true;
+}
+
+// Reads a line without its line ending; longer lines are truncated. Returns
+// false at the end of the stream.
+static bool read_line(io_reader* reader, char* line, size_t size) {
+  size_t len = 0;
+  int c = read_byte(reader);
+  if (c < 0) {
+    return false;
+  }
+  while (c >= 0 && c != '\n') {
+    if (c != '\r' && len + 1 < size) {
+      line[len++] = (char) c;
+    }
+    c = read_byte(reader);
+  }
+  line[len] = '\0';
+  return true;
+}
+
+static inline int get_hex_digit(char c) {
+  return is_hex(c) ? get_hex_value(c) : -1;
+}
+
+// Glyphs and codepoints being loaded from a font file
+typedef struct {
+  unsigned char* bits;
+  unsigned int nb_glyphs;
+  unsigned int glyphs_capacity;
+  Uint64* pairs; // codepoint << 32 | glyph index (| PAIR_WIDE)
+  unsigned int nb_pairs;
+  unsigned int pairs_capacity;
+  Uint8 glyph_height;
+  bool has_wide_glyphs;
+} font_builder;
+
+// flags the glyph of a pair as the left half of a wide glyph, whose right
+// half is the next glyph
+#define PAIR_WIDE 0x80000000u
+
+// Returns the (zeroed) bitmap of a new glyph, or NULL on failure.
+static unsigned char* add_glyph(font_builder* builder) {
+  if (builder->nb_glyphs == builder->glyphs_capacity) {
+    unsigned int capacity = SDL_max(256, builder->glyphs_capacity * 2);
+    unsigned char* bits =
+        mem_realloc(builder->bits, (size_t) capacity * builder->glyph_height);
+    if (bits == NULL) {
+      return NULL;
+    }
+    builder->bits = bits;
+    builder->glyphs_capacity = capacity;
+  }
+  unsigned char* glyph =
+      &builder->bits[(size_t) builder->nb_glyphs++ * builder->glyph_height];
+  SDL_memset(glyph, 0, builder->glyph_height);
+  return glyph;
+}
+
+static bool add_codepoint(font_builder* builder, Uint32 cp, Uint32 glyph) {
+  if (cp > 0x10ffff) {
+    return true;
+  }
+  if (builder->nb_pairs == builder->pairs_capacity) {
+    unsigned int capacity = SDL_max(256, builder->pairs_capacity * 2);
+    Uint64* pairs = mem_realloc(builder->pairs, capacity * sizeof(Uint64));
+    if (pairs == NULL) {
+      return false;
+    }
+    builder->pairs = pairs;
+    builder->pairs_capacity = capacity;
+  }
+  builder->pairs[builder->nb_pairs++] = (Uint64) cp << 32 | glyph;
+  return true;
+}
+
+static int compare_pairs(const void* a, const void* b) {
+  const Uint64 pa = *(const Uint64*) a;
+  const Uint64 pb = *(const Uint64*) b;
+  return pa < pb ? -1 : pa > pb;
+}
+
+// Moves the loaded glyphs into a font. Fonts covering every codepoint up to
+// their last one are stored densely (glyph N is codepoint N), others keep a
+// sorted codepoint table, so that the codepoints they miss are found in their
+// fallbacks.
+static bool finish_font(
+    font_builder* builder, DBGP_Font* font, SDL_Renderer* renderer) {
+  if (builder->nb_pairs == 0) {
+    return SDL_SetError("Font has no glyph");
+  }
+
+  bool sorted = true;
+  for (unsigned int i = 1; i < builder->nb_pairs && sorted; i++) {
+    sorted = builder->pairs[i - 1] < builder->pairs[i];
+  }
+  if (!sorted) {
+    SDL_qsort(
+        builder->pairs, builder->nb_pairs, sizeof(Uint64), compare_pairs);
+  }
+  // keep the first glyph of each codepoint
+  unsigned int nb_pairs = 1;
+  for (unsigned int i = 1; i < builder->nb_pairs; i++) {
+    if (builder->pairs[i] >> 32 != builder->pairs[nb_pairs - 1] >> 32) {
+      builder->pairs[nb_pairs++] = builder->pairs[i];
+    }
+  }
+  builder->nb_pairs = nb_pairs;
+
+  const size_t h = builder->glyph_height;
+  const Uint32 last_cp = builder->pairs[nb_pairs - 1] >> 32;
+  SDL_memset(font, 0, sizeof(*font));
+  font->glyph_width = GLYPH_WIDTH;
+  font->glyph_height = builder->glyph_height;
+
+  if (last_cp + 1 == nb_pairs && !builder->has_wide_glyphs) {
+    font->nb_glyphs = last_cp + 1;
+    font->raw_data = mem_calloc(font->nb_glyphs, h);
+    if (font->raw_data == NULL) {
+      return false;
+    }
+    for (unsigned int i = 0; i < nb_pairs; i++) {
+      SDL_memcpy(
+          &font->raw_data[(builder->pairs[i] >> 32) * h],
+          &builder->bits[(builder->pairs[i] & 0xffffffff) * h], h);
+    }
+  } else {
+    font->codepoints = mem_malloc(nb_pairs * sizeof(Uint32));
+    font->codepoint_glyphs = mem_malloc(nb_pairs * sizeof(Uint32));
+    if (font->codepoints == NULL || font->codepoint_glyphs == NULL) {
+      DBGP_DestroyFont(font);
+      return false;
+    }
+    for (unsigned int i = 0; i < nb_pairs; i++) {
+      font->codepoints[i] = builder->pairs[i] >> 32;
+      font->codepoint_glyphs[i] = builder->pairs[i] & ~PAIR_WIDE;
+    }
+    if (builder->has_wide_glyphs) {
+      font->wide_glyphs = mem_calloc((builder->nb_glyphs + 7) / 8, 1);
+      if (font->wide_glyphs == NULL) {
+        DBGP_DestroyFont(font);
+        return false;
+      }
+      for (unsigned int i = 0; i < nb_pairs; i++) {
+        if (builder->pairs[i] & PAIR_WIDE) {
+          const Uint32 glyph = font->codepoint_glyphs[i];
+          font->wide_glyphs[glyph / 8] |= 1 << (glyph % 8);
+        }
+      }
+    }
+    font->nb_codepoints = nb_pairs;
+    font->nb_glyphs = builder->nb_glyphs;
+    font->raw_data = builder->bits;
+    builder->bits = NULL;
+  }
+
+  if (renderer != NULL && !create_font_textures(font, renderer)) {
+    DBGP_DestroyFont(font);
+    return false;
+  }
+  return true;
+}
+
+static bool load_hex(font_builder* builder, io_reader* reader) {
+  char line[256];
+  while (read_line(reader, line, sizeof(line))) {
+    const char* ptr = line;
+    Uint32 cp = 0;
+    int digit = 0;
+    while ((digit = get_hex_digit(*ptr)) >= 0 && ptr - line < 6) {
+      cp = cp << 4 | digit;
+      ptr++;
+    }
+    // longer codepoints would have wrapped around
+    if (ptr == line || *ptr != ':' || cp > 0x10ffff) {
+      continue;
+    }
+    ptr++;
+
+    // glyphs are 8px wide (2 digits per row), or 16px wide (4 digits per
+    // row) and split into two glyphs
+    const size_t len = SDL_strlen(ptr);
+    const int digits = len == builder->glyph_height * 2u   ? 2
+                       : len == builder->glyph_height * 4u ? 4
+                                                           : 0;
+    if (digits == 0) {
+      continue;
+    }
+    for (int half = 0; half < digits / 2; half++) {
+      unsigned char* glyph = add_glyph(builder);
+      if (glyph == NULL) {
+        return false;
+      }
+      for (int row = 0; row < builder->glyph_height; row++) {
+        int hi = get_hex_digit(ptr[row * digits + half * 2]);
+        int lo = get_hex_digit(ptr[row * digits + half * 2 + 1]);
+        glyph[row] = (hi < 0 || lo < 0) ? 0 : hi << 4 | lo;
+      }
+    }
+    const Uint32 first = builder->nb_glyphs - digits / 2;
+    if (!add_codepoint(builder, cp, digits == 4 ? first | PAIR_WIDE : first)) {
+      return false;
+    }
+    builder->has_wide_glyphs |= digits == 4;
+  }
+  return true;
+}
+
+// Decodes a UTF-8 sequence from a PSF2 unicode table. Invalid sequences
+// (invalid lead byte, truncated, overlong, surrogate) decode above U+10FFFF,
+// so that add_codepoint skips them. Returns the first byte following the
+// sequence, or -1 at the end of the stream.
+static int read_psf_utf8(io_reader* reader, int c, Uint32* cp) {
+  static const Uint32 min_cp[] = {0, 0x80, 0x800, 0x10000};
+  const bool valid_lead = c < 0x80 || (c >= 0xc2 && c <= 0xf4);
+  const int length =
+      !valid_lead ? 0 : c >= 0xf0 ? 3 : c >= 0xe0 ? 2 : c >= 0xc0 ? 1 : 0;
+  int nb_continuation = length;
+  *cp = c & (0x7f >> nb_continuation);
+  c = read_byte(reader);
+  for (; nb_continuation > 0 && c >= 0 && (c & 0xc0) == 0x80;
+       nb_continuation--) {
+    *cp = *cp << 6 | (c & 0x3f);
+    c = read_byte(reader);
+  }
+  if (!valid_lead || nb_continuation > 0 || *cp < min_cp[length] ||
+      (*cp >= 0xd800 && *cp <= 0xdfff)) {
+    *cp = SDL_MAX_UINT32;
+  }
+  return c;
+}
+
+static bool load_psf(font_builder* builder, io_reader* reader) {
+  Uint8 header[32];
+  if (!read_bytes(reader, header, 4)) {
+    return SDL_SetError("Invalid PSF font");
+  }
+
+  Uint32 nb_glyphs = 0;
+  Uint32 charsize = 0;
+  bool has_table = false;
+  bool psf1 = false;
+  if (header[0] == 0x36 && header[1] == 0x04) {
+    // PSF1: 256 or 512 glyphs, 8px wide
+    psf1 = true;
+    nb_glyphs = header[2] & 0x01 ? 512 : 256;
+    has_table = (header[2] & 0x06) != 0;
+    charsize = header[3];
+  } else if (
+      header[0] == 0x72 && header[1] == 0xb5 && header[2] == 0x4a &&
+      header[3] == 0x86) {
+    if (!read_bytes(reader, header + 4, 28)) {
+      return SDL_SetError("Invalid PSF font");
+    }
+    Uint32 fields[8];
+    for (int i = 0; i < 8; i++) {
+      fields[i] = (Uint32) header[i * 4] | (Uint32) header[i * 4 + 1] << 8 |
+                  (Uint32) header[i * 4 + 2] << 16 |
+                  (Uint32) header[i * 4 + 3] << 24;
+    }
+    // fields: magic, version, headersize, flags, length, charsize, height,
+    // width
+    if (fields[7] > GLYPH_WIDTH) {
+      return SDL_SetError("PSF glyphs wider than 8px are not supported");
+    }
+    if (fields[2] < 32 || !read_bytes(reader, NULL, fields[2] - 32)) {
+      return SDL_SetError("Invalid PSF font");
+    }
+    has_table = (fields[3] & 1) != 0;
+    nb_glyphs = fields[4];
+    charsize = fields[5];
+    if (fields[6] != charsize) {
+      return SDL_SetError("Invalid PSF font");
+    }
+  } else {
+    return SDL_SetError("Invalid PSF font");
+  }
+
+  if (charsize == 0 || charsize > 255) {
+    return SDL_SetError("Unsupported PSF glyph height: %u", charsize);
+  }
+  builder->glyph_height = (Uint8) charsize;
+  for (Uint32 i = 0; i < nb_glyphs; i++) {
+    unsigned char* glyph = add_glyph(builder);
+    if (glyph == NULL) {
+      return false;
+    }
+    if (!read_bytes(reader, glyph, charsize)) {
+      return SDL_SetError("Truncated PSF font");
+    }
+    if (!has_table && !add_codepoint(builder, i, i)) {
+      return false;
+    }
+  }
+  if (!has_table) {
+    return true;
+  }
+
+  // unicode table: the codepoints of each glyph, then optional sequences
+  // (which are ignored), then a terminator
+  for (Uint32 i = 0; i < nb_glyphs; i++) {
+    bool in_sequence = false;
+    for (;;) {
+      Uint32 value = 0;
+      if (psf1) {
+        Uint8 bytes[2];
+        if (!read_bytes(reader, bytes, 2)) {
+          return true;
+        }
+        value = bytes[0] | bytes[1] << 8;
+        if (value == 0xffff) {
+          break;
+        }
+        in_sequence = in_sequence || value == 0xfffe;
+        if (!in_sequence && !add_codepoint(builder, value, i)) {
+          return false;
+        }
+      } else {
+        int c = read_byte(reader);
+        if (c < 0) {
+          return true;
+        }
+        if (c == 0xff) {
+          break;
+        }
+        if (c == 0xfe) {
+          in_sequence = true;
+          continue;
+        }
+        // the byte following the sequence is read ahead: push it back
+        c = read_psf_utf8(reader, c, &value);
+        if (c >= 0) {
+          reader->pos--;
+        }
+        if (!in_sequence && !add_codepoint(builder, value, i)) {
+          return false;
+        }
+      }
+    }
+  }
+  return true;
+}
+
+// Returns true if line starts with the given keyword, followed by a space or
+// the end of the line, and stores a pointer to its arguments.
+static bool match_keyword(
+    const char* line, const char* keyword, const char** args) {
+  size_t len = SDL_strlen(keyword);
+  if (SDL_strncmp(line, keyword, len) != 0 ||
+      (line[len] != ' ' && line[len] != '\0')) {
+    return false;
+  }
+  *args = line + len;
+  return true;
+}
+
+static int parse_ints(const char* str, int* values, int max) {
+  int n = 0;
+  char* end = NULL;
+  while (n < max) {
+    long value = SDL_strtol(str, &end, 10);
+    if (end == str) {
+      break;
+    }
+    values[n++] = (int) value;
+    str = end;
+  }
+  return n;
+}
+
+static bool load_bdf(font_builder* builder, io_reader* reader) {
+  char line[256];
+  const char* args = NULL;
+  int fbb[4] = {0, 0, 0, 0}; // font bounding box: width, height, x, y
+  int ascent = -1;
+  bool in_font = false;
+
+  // glyph being read
+  int encoding = -1;
+  int bbx[4] = {0, 0, 0, 0};
+  int row = -1;
+  unsigned char* glyph = NULL;
+
+  while (read_line(reader, line, sizeof(line))) {
+    if (row >= 0) {
+      if (SDL_strcmp(line, "ENDCHAR") == 0) {
+        row = -1;
+        continue;
+      }
+      // rows are stored from the top of the glyph bounding box, which is
+      // placed relative to the baseline of the font
+      const int y = (ascent - bbx[3] - bbx[1]) + row++;
+      if (glyph == NULL || y < 0 || y >= builder->glyph_height) {
+        continue;
+      }
+      Uint32 bits = 0;
+      for (int i = 0; i < 6; i++) {
+        int digit = get_hex_digit(line[i]);
+        if (digit < 0) {
+          bits <<= 4 * (6 - i);
+          break;
+        }
+        bits = bits << 4 | digit;
+      }
+      // the leftmost pixel is bit 23; shift it to the glyph X offset
+      const int shift = 16 + (bbx[2] - fbb[2]);
+      glyph[y] = shift >= 0 && shift < 32 ? (bits >> shift) & 0xff : 0;
+    } else if (match_keyword(line, "FONTBOUNDINGBOX", &args)) {
+      if (parse_ints(args, fbb, 4) != 4 || fbb[1] <= 0 || fbb[1] > 255) {
+        return SDL_SetError("Invalid BDF bounding box");
+      }
+      if (fbb[0] > GLYPH_WIDTH) {
+        return SDL_SetError("BDF glyphs wider than 8px are not supported");
+      }
+      builder->glyph_height = (Uint8) fbb[1];
+      in_font = true;
+    } else if (match_keyword(line, "FONT_ASCENT", &args)) {
+      parse_ints(args, &ascent, 1);
+    } else if (match_keyword(line, "STARTCHAR", &args)) {
+      if (!in_font) {
+        return SDL_SetError("Invalid BDF font");
+      }
+      encoding = -1;
+      SDL_memcpy(bbx, fbb, sizeof(bbx));
+    } else if (match_keyword(line, "ENCODING", &args)) {
+      parse_ints(args, &encoding, 1);
+    } else if (match_keyword(line, "BBX", &args)) {
+      parse_ints(args, bbx, 4);
+    } else if (match_keyword(line, "BITMAP", &args)) {
+      if (ascent < 0) {
+        ascent = fbb[1] + fbb[3];
+      }
+      row = 0;
+      glyph = NULL;
+      if (encoding >= 0) {
+        glyph = add_glyph(builder);
+        if (glyph == NULL ||
+            !add_codepoint(builder, encoding, builder->nb_glyphs - 1)) {
+          return false;
+        }
+      }
+    }
+  }
+  return true;
+}
+
+typedef bool (*font_loader)(font_builder* builder, io_reader* reader);
+
+static bool create_font_from_io(
+    DBGP_Font* font, SDL_Renderer* renderer, SDL_IOStream* src, bool closeio,
+    Uint8 glyph_height, font_loader load) {
+  if (font == NULL || src == NULL) {
+    if (src != NULL && closeio) {
+      SDL_CloseIO(src);
+    }
+    return false;
+  }
+
+  SDL_memset(font, 0, sizeof(*font));
+  io_reader* reader = mem_malloc(sizeof(io_reader));
+  font_builder builder;
+  SDL_memset(&builder, 0, sizeof(builder));
+  builder.glyph_height = glyph_height;
+
+  bool result = reader != NULL;
+  if (result) {
+    reader->src = src;
+    reader->pos = 0;
+    reader->len = 0;
+    result = load(&builder, reader) && finish_font(&builder, font, renderer);
+  }
+  if (!result) {
+    // as with DBGP_CreateFont, a font that failed is zeroed (and can be
+    // destroyed)
+    free_font(font);
+    SDL_memset(font, 0, sizeof(*font));
+  }
+
+  mem_free(builder.bits);
+  mem_free(builder.pairs);
+  mem_free(reader);
+  if (closeio) {
+    SDL_CloseIO(src);
+  }
+  return result;
+}
+
+bool DBGP_CreateFontFromHex(
+    DBGP_Font* font, SDL_Renderer* renderer, SDL_IOStream* src, bool closeio,
+    Uint8 glyph_height) {
+  if (glyph_height == 0) {
+    if (src != NULL && closeio) {
+      SDL_CloseIO(src);
+    }
+    return SDL_SetError("Invalid glyph height");
+  }
+  return create_font_from_io(
+      font, renderer, src, closeio, glyph_height, load_hex);
+}
+
+bool DBGP_CreateFontFromPSF(
+    DBGP_Font* font, SDL_Renderer* renderer, SDL_IOStream* src, bool closeio) {
+  return create_font_from_io(font, renderer, src, closeio, 0, load_psf);
+}
+
+bool DBGP_CreateFontFromBDF(
+    DBGP_Font* font, SDL_Renderer* renderer, SDL_IOStream* src, bool closeio) {
+  return create_font_from_io(font, renderer, src, closeio, 0, load_bdf);
+}
+
+// Decodes the next codepoint of a string, applying the color escape codes
+// found before it to colors. Returns 0 at the end of the string.
+static inline Uint32 step_color_string(const char** ptr, Uint8* colors) {
+  Uint32 cp = SDL_StepUTF8(ptr, NULL);
+  while (cp == DBGP_ESCAPE_CHAR && DBGP_ENABLE_ESCAPING) {
+    const char* ptr_start_seq = *ptr;
+    Uint32 cp1 = SDL_StepUTF8(ptr, NULL);
+    Uint32 cp2 = SDL_StepUTF8(ptr, NULL);
+
+    if (is_hex(cp1) && is_hex(cp2)) {
+      Uint8 bg = get_hex_value(cp1);
+      Uint8 fg = get_hex_value(cp2);
+      *colors = (bg & 0xf) << 4 | (fg & 0xf);
+      cp = SDL_StepUTF8(ptr, NULL);
+    } else {
+      *ptr = ptr_start_seq;
+      break;
+    }
+  }
+  return cp;
+}
+
+// The state of a string drawn with DBGP_ColorPrint, whose escape codes also
+// move the position of the next glyph and repeat glyphs.
+typedef struct {
+  const char* ptr;
+  Uint8 colors;
+  int x; // the origin of the text
+  int y;
+  int ix; // the position of the next glyph
+  int iy;
+  Uint32 repeat_cp;
+  int repeat; // the number of times repeat_cp is still to be drawn
+  int prev_width; // see draw_text_glyph
+} text_cursor;
+
+static inline void init_text_cursor(
+    text_cursor* cursor, const char* str, int x, int y, Uint8 colors) {
+  cursor->ptr = str;
+  cursor->colors = colors;
+  cursor->x = cursor->ix = x;
+  cursor->y = cursor->iy = y;
+  cursor->repeat_cp = 0;
+  cursor->repeat = 0;
+  cursor->prev_width = 0;
+}
+
+// Parses an optionally negative decimal number of an escape code, moving ptr
+// after it (values are clamped to about a million).
+static bool parse_escape_int(const char** ptr, int* value) {
+  const char* p = *ptr;
+  const bool negative = *p == '-';
+  if (negative) {
+    p++;
+  }
+  if (*p < '0' || *p > '9') {
+    return false;
+  }
+  int v = 0;
+  for (; *p >= '0' && *p <= '9'; p++) {
+    if (v < 100000) {
+      v = v * 10 + (*p - '0');
+    }
+  }
+  *value = negative ? -v : v;
+  *ptr = p;
+  return true;
+}
+
+// Parses the positioning or repeat escape code following an escape character
+// (cursor->ptr points after it), returning false if there is none.
+static bool parse_cursor_escape(text_cursor* cursor, const DBGP_Font* font) {
+  const char* p = cursor->ptr;
+  const char type = *p++;
+  int a = 0;
+  int b = 0;
+  if (type == '*') {
+    if (!parse_escape_int(&p, &a) || a < 0 || *p != ';' || p[1] == '\0') {
+      return false;
+    }
+    p++;
+    cursor->repeat_cp = SDL_StepUTF8(&p, NULL);
+    cursor->repeat = a;
+    cursor->ptr = p;
+    return true;
+  }
+  if ((type != 'G' && type != 'P' && type != 'M') ||
+      !parse_escape_int(&p, &a) || *p != ',') {
+    return false;
+  }
+  p++;
+  if (!parse_escape_int(&p, &b) || *p != ';') {
+    return false;
+  }
+  p++;
+
+  switch (type) {
+  case 'G':
+    cursor->ix = cursor->x + a * font->glyph_width;
+    cursor->iy = cursor->y + b * font->glyph_height;
+    break;
+  case 'P':
+    cursor->ix = cursor->x + a;
+    cursor->iy = cursor->y + b;
+    break;
+  default:
+    cursor->ix += a;
+    cursor->iy += b;
+    break;
+  }
+  cursor->prev_width = 0;
+  cursor->ptr = p;
+  return true;
+}
+
+// Returns the next codepoint to draw at (cursor->ix, cursor->iy), applying
+// the escape codes, newlines and tabs found before it. Returns 0 at the end
+// of the string.
+static inline Uint32 step_text_cursor(
+    text_cursor* cursor, const DBGP_Font* font) {
+  for (;;) {
+    Uint32 cp = 0;
+    if (cursor->repeat > 0) {
+      cursor->repeat--;
+      cp = cursor->repeat_cp;
+    } else {
+      cp = step_color_string(&cursor->ptr, &cursor->colors);
+      if (cp == DBGP_ESCAPE_CHAR && DBGP_ENABLE_ESCAPING &&
+          parse_cursor_escape(cursor, font)) {
+        continue;
+      }
+    }
+
+    if (cp == '\n') {
+      cursor->iy += font->glyph_height;
+      cursor->ix = cursor->x;
+      cursor->prev_width = 0;
+    } else if (cp == '\t' && DBGP_ENABLE_ESCAPING) {
+      // tab stops are relative to the origin of the text
+      const int tab = DBGP_TAB_WIDTH * font->glyph_width;
+      int stop = (cursor->ix - cursor->x) / tab * tab;
+      if (stop <= cursor->ix - cursor->x) {
+        stop += tab;
+      }
+      cursor->ix = cursor->x + stop;
+      cursor->prev_width = 0;
+    } else if (cp < 256 || cp != SDL_INVALID_UNICODE_CODEPOINT) {
+      return cp;
+    }
+  }
+}
+
+// Queues a glyph drawn with CGA colors (a background of color 0 is
+// transparent).
+static inline void draw_color_glyph(
+    DBGP_Font* font, float x, float y, Uint32 cp, Uint8 colors) {
+  const SDL_FColor bg = get_palette_color(colors >> 4);
+  draw_glyph(
+      NULL, font, x, y, cp, colors >> 4 != 0 ? &bg : NULL,
+      get_palette_color(colors & 0xf));
+}
+
+// Same as draw_color_glyph, for a codepoint of text (see draw_text_glyph).
+static inline int draw_color_text_glyph(
+    geometry_output* out, DBGP_Font* font, float x, float y, int* prev_width,
+    Uint32 cp, Uint8 colors) {
+  const SDL_FColor bg = get_palette_color(colors >> 4);
+  return draw_text_glyph(
+      out, font, x, y, prev_width, cp, colors >> 4 != 0 ? &bg : NULL,
+      get_palette_color(colors & 0xf));
+}
+
+// Queues the glyphs of a string drawn with DBGP_ColorPrint, or adds them to
+// out if it isn't NULL.
+static void color_print_string(
+    geometry_output* out, DBGP_Font* font, int x, int y, Uint8 colors,
+    const char* str) {
+  text_cursor cursor;
+  init_text_cursor(&cursor, str, x, y, colors);
+
+  Uint32 cp = 0;
+  while ((cp = step_text_cursor(&cursor, font)) != 0) {
+    cursor.ix += draw_color_text_glyph(
+        out, font, cursor.ix, cursor.iy, &cursor.prev_width, cp,
+        cursor.colors);
+  }
+}
+
+bool DBGP_ColorPrint(
+    DBGP_Font* font, SDL_Renderer* renderer, int x, int y, Uint8 colors,
+    const char* str) {
+  if (font == NULL || font->tex == NULL || renderer == NULL) {
+    return false;
+  }
+  if (is_tracing() || is_recording(renderer)) {
+    overlay_command command;
+    SDL_memset(&command, 0, sizeof(command));
+    command.type = OVERLAY_COLOR_PRINT;
+    command.font = font;
+    command.box.x = x;
+    command.box.y = y;
+    command.colors = colors;
+    trace_command(&command, str);
+    if (is_recording(renderer)) {
+      return record_overlay_command(&command, str);
+    }
+  }
+
+  if (!begin_batch(renderer)) {
+    return false;
+  }
+  color_print_string(NULL, font, x, y, colors, str);
+  end_batch();
+
+  return true;
+}
+
+bool DBGP_ColorPrintf(
+    DBGP_Font* font, SDL_Renderer* renderer, int x, int y, Uint8 colors,
+    const char* fmt, ...) {
+  const arena_mark mark = get_arena_mark();
+  va_list args;
+  va_start(args, fmt);
+  const char* str = format_string(fmt, args);
+  va_end(args);
+
+  const bool result =
+      str != NULL && DBGP_ColorPrint(font, renderer, x, y, colors, str);
+  release_arena(mark);
+  return result;
+}
+
+// Shared implementation of the *MeasureText functions: escape codes are
+// parsed when color is true.
+static bool measure_text(
+    const DBGP_Font* font, const char* str, bool color, int* w, int* h) {
+  if (font == NULL || str == NULL) {
+    return false;
+  }
+  text_cursor cursor;
+  init_text_cursor(&cursor, str, 0, 0, DBGP_DEFAULT_COLORS);
+  int right = 0;
+  int bottom = 0;
+
+  Uint32 cp = 0;
+  while ((cp = color ? step_text_cursor(&cursor, font)
+                     : SDL_StepUTF8(&cursor.ptr, NULL)) != 0) {
+    if (cp >= 256 && cp == SDL_INVALID_UNICODE_CODEPOINT) {
+      continue;
+    }
+
+    if (cp == '\n') {
+      cursor.iy += font->glyph_height;
+      cursor.ix = 0;
+      continue;
+    }
+    cursor.ix += get_codepoint_width(cp) * font->glyph_width;
+    right = SDL_max(right, cursor.ix);
+    bottom = SDL_max(bottom, cursor.iy + font->glyph_height);
+  }
+
+  if (w) {
+    *w = right;
+  }
+  if (h) {
+    *h = bottom;
+  }
+  return true;
+}
+
+bool DBGP_MeasureText(const DBGP_Font* font, const char* str, int* w, int* h) {
+  return measure_text(font, str, false, w, h);
+}
+
+bool DBGP_ColorMeasureText(
+    const DBGP_Font* font, const char* str, int* w, int* h) {
+  return measure_text(font, str, true, w, h);
+}
+
+// Returns the height of the atlas pixels of a font with a number of columns.
+static inline int get_geometry_height(const DBGP_Font* font, int columns) {
+  return (font->nb_glyphs + columns) / columns * font->glyph_height;
+}
+
+// Lays out a string drawn with DBGP_Print (when bg_color isn't NULL) or
+// DBGP_ColorPrint into the caller arrays, returning its number of quads.
+static int build_geometry(
+    DBGP_Font* font, int x, int y, const SDL_Color* bg_color,
+    const SDL_Color* fg_color, Uint8 colors, const char* str,
+    SDL_Vertex* vertices, int* indices, int max_quads) {
+  if (font == NULL || font->raw_data == NULL || str == NULL ||
+      max_quads < 0 || (vertices == NULL) != (indices == NULL)) {
+    return -1;
+  }
+
+  geometry_output out;
+  out.font = font;
+  out.vertices = vertices;
+  out.indices = indices;
+  out.max_quads = max_quads;
+  out.nb_quads = 0;
+  out.columns = get_geometry_columns(font);
+  out.width = out.columns * font->glyph_width;
+  out.height = get_geometry_height(font, out.columns);
+  if (bg_color != NULL && fg_color != NULL) {
+    print_string(&out, font, x, y, *bg_color, *fg_color, str);
+  } else {
+    color_print_string(&out, font, x, y, colors, str);
+  }
+
+  return out.nb_quads;
+}
+
+int DBGP_BuildGeometry(
+    DBGP_Font* font, int x, int y, SDL_Color bg_color, SDL_Color fg_color,
+    const char* str, SDL_Vertex* vertices, int* indices, int max_quads) {
+  return build_geometry(
+      font, x, y, &bg_color, &fg_color, 0, str, vertices, indices, max_quads);
+}
+
+int DBGP_ColorBuildGeometry(
+    DBGP_Font* font, int x, int y, Uint8 colors, const char* str,
+    SDL_Vertex* vertices, int* indices, int max_quads) {
+  return build_geometry(
+      font, x, y, NULL, NULL, colors, str, vertices, indices, max_quads);
+}
+
+bool DBGP_GetFontAtlasPixels(
+    const DBGP_Font* font, void* pixels, int* width, int* height) {
+  if (font == NULL || font->raw_data == NULL) {
+    return false;
+  }
+  const int columns = get_geometry_columns(font);
+  const int w = columns * font->glyph_width;
+  const int h = get_geometry_height(font, columns);
+  if (width != NULL) {
+    *width = w;
+  }
+  if (height != NULL) {
+    *height = h;
+  }
+  if (pixels == NULL) {
+    return true;
+  }
+
+  SDL_memset(pixels, 0, (size_t) w * h * sizeof(Uint32));
+  // the cell after the last glyph is the white cell of the backgrounds
+  for (unsigned int i = 0; i <= font->nb_glyphs; i++) {
+    const unsigned char* glyph =
+        &font->raw_data[(size_t) i * font->glyph_height];
+    Uint32* dst = (Uint32*) pixels +
+                  (size_t) (i / columns) * font->glyph_height * w +
+                  i % columns * font->glyph_width;
+    for (int row = 0; row < font->glyph_height; row++) {
+      const Uint8 bits = i < font->nb_glyphs ? glyph[row] : 0xff;
+      for (int col = 0; col < GLYPH_WIDTH; col++) {
+        if (bits & (0x80 >> col)) {
+          dst[col] = 0xffffffff;
+        }
+      }
+      dst += w;
+    }
+  }
+
+  return true;
+}
+
+// Draws a grid of cells of cell_size bytes (2 or 4), see DBGP_RenderCells.
+static bool render_cells(
+    DBGP_Font* font, SDL_Renderer* renderer, int x, int y, const void* cells,
+    int cell_size, int cols, int rows, int stride) {
+  if (font == NULL || font->tex == NULL || renderer == NULL ||
+      cells == NULL || cols < 0 || rows < 0 || (stride != 0 && stride < cols)) {
+    return false;
+  }
+  if (!check_not_recording(renderer)) {
+    return false;
+  }
+  if (stride == 0) {
+    stride = cols;
+  }
+  SDL_FColor palette[16];
+  for (int i = 0; i < 16; i++) {
+    palette[i] = get_palette_color(i);
+  }
+  const int glyph_shift = cell_size == 2 ? 8 : 24;
+  const Uint32 glyph_mask = (1u << glyph_shift) - 1;
+  const float w = font->glyph_width;
+  const float h = font->glyph_height;
+
+  const int nb_cells = cols * rows;
+  if (!begin_sized_batch(
+          renderer, SDL_clamp(nb_cells, 1, BATCH_MAX_CELL_QUADS),
+          SDL_min(
+              get_style_atlas(font, font->style)->nb_pages,
+              BATCH_MAX_TEXTURES))) {
+    return false;
+  }
+  for (int row = 0; row < rows; row++) {
+    const Uint8* line =
+        (const Uint8*) cells + (size_t) row * stride * cell_size;
+    const float cy = y + row * h;
+    for (int col = 0; col < cols; col++) {
+      const Uint32 cell = cell_size == 2 ? ((const Uint16*) line)[col]
+                                         : ((const Uint32*) line)[col];
+      const Uint32 glyph = cell & glyph_mask;
+      const Uint8 colors = cell >> glyph_shift;
+      const float cx = x + col * w;
+      if (colors >> 4 != 0) {
+        draw_rect(cx, cy, w, h, palette[colors >> 4]);
+      }
+      if (glyph < font->nb_glyphs) {
+        queue_glyph(font, font->style, glyph, cx, cy, palette[colors & 0xf]);
+      }
+    }
+  }
+  end_batch();
+
+  return true;
+}
+
+bool DBGP_RenderCells(
+    DBGP_Font* font, SDL_Renderer* renderer, int x, int y,
+    const Uint16* cells, int cols, int rows, int stride) {
+  return render_cells(
+      font, renderer, x, y, cells, sizeof(*cells), cols, rows, stride);
+}
+
+bool DBGP_RenderCells32(
+    DBGP_Font* font, SDL_Renderer* renderer, int x, int y,
+    const Uint32* cells, int cols, int rows, int stride) {
+  return render_cells(
+      font, renderer, x, y, cells, sizeof(*cells), cols, rows, stride);
+}
+
+bool DBGP_RenderCompiled(
+    DBGP_Font* font, SDL_Renderer* renderer, int x, int y,
+    const DBGP_CompiledGlyph* glyphs, int nb_glyphs) {
+  if (font == NULL || font->tex == NULL || renderer == NULL ||
+      (glyphs == NULL && nb_glyphs > 0) || nb_glyphs < 0) {
+    return false;
+  }
+  if (!check_not_recording(renderer)) {
+    return false;
+  }
+  const float w = font->glyph_width;
+  const float h = font->glyph_height;
+
+  if (!begin_sized_batch(
+          renderer, SDL_clamp(nb_glyphs, 1, BATCH_MAX_CELL_QUADS),
+          SDL_min(
+              get_style_atlas(font, font->style)->nb_pages,
+              BATCH_MAX_TEXTURES))) {
+    return false;
+  }
+  for (int i = 0; i < nb_glyphs; i++) {
+    const DBGP_CompiledGlyph* glyph = &glyphs[i];
+    const float gx = x + glyph->column * w;
+    const float gy = y + glyph->line * h;
+    if (glyph->colors >> 4 != 0) {
+      draw_rect(gx, gy, w, h, get_palette_color(glyph->colors >> 4));
+    }
+    if (glyph->glyph < font->nb_glyphs) {
+      queue_glyph(
+          font, font->style, glyph->glyph, gx, gy,
+          get_palette_color(glyph->colors & 0xf));
+    }
+  }
+  end_batch();
+
+  return true;
+}
+
+// Queues nb_glyphs glyphs of str, with the same rules as DBGP_ColorPrint
+// (newlines excluded).
+static void draw_color_run(
+    DBGP_Font* font, int x, int y, Uint8 colors, const char* str,
+    int nb_glyphs) {
+  const char* ptr = str;
+  int ix = x;
+  int prev_width = 0;
+  for (int i = 0; i < nb_glyphs;) {
+    Uint32 cp = step_color_string(&ptr, &colors);
+    if (cp == 0) {
+      break;
+    }
+    if (cp >= 256 && cp == SDL_INVALID_UNICODE_CODEPOINT) {
+      continue;
+    }
+
+    ix += draw_color_text_glyph(NULL, font, ix, y, &prev_width, cp, colors);
+    i++;
+  }
+}
+
+// Skips the spaces at the start of a wrapped line.
+static void skip_spaces(const char** ptr, Uint8* colors) {
+  for (;;) {
+    const char* p = *ptr;
+    Uint8 icolors = *colors;
+    if (step_color_string(&p, &icolors) != ' ') {
+      return;
+    }
+    *ptr = p;
+    *colors = icolors;
+  }
+}
+
+// Finds the end of the line starting at *ptr, which must not be wider than
+// max_cells cells (unless its first glyph is). *ptr and *colors are moved to
+// the start of the next line, after the spaces at the break. Returns true
+// when the line is the last one of its paragraph, in which case *ptr points
+// after the newline (or on the terminating NULL character).
+static bool wrap_line(
+    const char** ptr, Uint8* colors, int max_cells, int flags,
+    int* nb_glyphs, int* nb_cells) {
+  const char* p = *ptr;
+  Uint8 icolors = *colors;
+  int glyphs = 0;
+  int cells = 0;
+
+  // position of the last space where the line can be broken
+  const char* break_next = NULL;
+  int break_glyphs = 0;
+  int break_cells = 0;
+  Uint8 break_colors = 0;
+
+  for (;;) {
+    const char* glyph_start = p;
+    Uint8 glyph_colors = icolors;
+    Uint32 cp = step_color_string(&p, &glyph_colors);
+
+    if (cp == 0 || cp == '\n') {
+      *ptr = p;
+      *colors = glyph_colors;
+      *nb_glyphs = glyphs;
+      *nb_cells = cells;
+      return true;
+    }
+    if (cp >= 256 && cp == SDL_INVALID_UNICODE_CODEPOINT) {
+      icolors = glyph_colors;
+      continue;
+    }
+
+    const int width = get_codepoint_width(cp);
+    if (glyphs > 0 && cells + width > max_cells) {
+      if (cp == ' ' && cells == max_cells) {
+        *ptr = p;
+        *colors = glyph_colors;
+        *nb_glyphs = glyphs;
+        *nb_cells = cells;
+      } else if ((flags & DBGP_WRAP_CHAR) == 0 && break_next != NULL) {
+        *ptr = break_next;
+        *colors = break_colors;
+        *nb_glyphs = break_glyphs;
+        *nb_cells = break_cells;
+      } else {
+        *ptr = glyph_start;
+        *colors = icolors;
+        *nb_glyphs = glyphs;
+        *nb_cells = cells;
+      }
+      // the spaces at the break aren't drawn, and when only a newline
+      // follows them, the line ends its paragraph
+      skip_spaces(ptr, colors);
+      const char* next = *ptr;
+      Uint8 next_colors = *colors;
+      cp = step_color_string(&next, &next_colors);
+      if (cp == 0 || cp == '\n') {
+        *ptr = next;
+        *colors = next_colors;
+        return true;
+      }
+      return false;
+    }
+
+    if (cp == ' ') {
+      break_next = p;
+      break_glyphs = glyphs;
+      break_cells = cells;
+      break_colors = glyph_colors;
+    }
+    icolors = glyph_colors;
+    glyphs++;
+    cells += width;
+  }
+}
+
+static int get_aligned_x(
+    const DBGP_Font* font, int x, int width, int flags, int nb_cells) {
+  const int line_width = nb_cells * font->glyph_width;
+  if (flags & DBGP_ALIGN_CENTER) {
+    return x + (width - line_width) / 2;
+  }
+  if (flags & DBGP_ALIGN_RIGHT) {
+    return x + width - line_width;
+  }
+  return x;
+}
+
+bool DBGP_PrintWrapped(
+    DBGP_Font* font, SDL_Renderer* renderer, const SDL_Rect* box, Uint8 colors,
+    int flags, const char* str) {
+  if (font == NULL || font->tex == NULL || renderer == NULL || box == NULL ||
+      str == NULL) {
+    return false;
+  }
+  if (is_tracing() || is_recording(renderer)) {
+    overlay_command command;
+    SDL_memset(&command, 0, sizeof(command));
+    command.type = OVERLAY_PRINT_WRAPPED;
+    command.font = font;
+    command.box = *box;
+    command.colors = colors;
+    command.flags = (Uint16) flags;
+    trace_command(&command, str);
+    if (is_recording(renderer)) {
+      return record_overlay_command(&command, str);
+    }
+  }
+
+  const int max_cells = SDL_max(box->w / font->glyph_width, 1);
+  const char* ptr = str;
+  int y = box->y;
+  if (!begin_batch(renderer)) {
+    return false;
+  }
+  while (*ptr != '\0' && y + font->glyph_height <= box->y + box->h) {
+    const char* line_start = ptr;
+    Uint8 line_colors = colors;
+    int nb_glyphs = 0;
+    int nb_cells = 0;
+    wrap_line(&ptr, &colors, max_cells, flags, &nb_glyphs, &nb_cells);
+
+    draw_color_run(
+        font, get_aligned_x(font, box->x, box->w, flags, nb_cells), y,
+        line_colors, line_start, nb_glyphs);
+    y += font->glyph_height;
+  }
+  end_batch();
+
+  return true;
+}
+
+bool DBGP_CreateTextLayout(
+    DBGP_TextLayout* layout, DBGP_Font* font, int flags) {
+  if (layout == NULL || font == NULL) {
+    return false;
+  }
+  SDL_memset(layout, 0, sizeof(*layout));
+  layout->font = font;
+  layout->flags = flags;
+  return true;
+}
+
+void DBGP_DestroyTextLayout(DBGP_TextLayout* layout) {
+  if (layout == NULL) {
+    return;
+  }
+  mem_free(layout->lines);
+  mem_free(layout->spare_lines);
+  mem_free(layout->paragraphs);
+  mem_free(layout->spare_paragraphs);
+  SDL_memset(layout, 0, sizeof(*layout));
+}
+
+// 64-bit FNV-1a
+static inline Uint64 hash_bytes(Uint64 hash, const void* data, size_t len) {
+  const Uint8* bytes = data;
+  for (size_t i = 0; i < len; i++) {
+    hash = (hash ^ bytes[i]) * 0x100000001b3ull;
+  }
+  return hash;
+}
+#define HASH_INIT 0xcbf29ce484222325ull
+
+static bool grow_text_layout(
+    DBGP_TextLayout* layout, int nb_lines, int nb_paragraphs) {
+  if (nb_lines > layout->lines_capacity) {
+    int capacity = SDL_max(nb_lines, layout->lines_capacity * 2);
+    DBGP_TextLine* lines =
+        mem_realloc(layout->lines, capacity * sizeof(DBGP_TextLine));
+    if (lines == NULL) {
+      return false;
+    }
+    layout->lines = lines;
+    lines = mem_realloc(layout->spare_lines, capacity * sizeof(DBGP_TextLine));
+    if (lines == NULL) {
+      return false;
+    }
+    layout->spare_lines = lines;
+    layout->lines_capacity = capacity;
+  }
+  if (nb_paragraphs > layout->paragraphs_capacity) {
+    int capacity = SDL_max(nb_paragraphs, layout->paragraphs_capacity * 2);
+    DBGP_TextParagraph* paragraphs = mem_realloc(
+        layout->paragraphs, capacity * sizeof(DBGP_TextParagraph));
+    if (paragraphs == NULL) {
+      return false;
+    }
+    layout->paragraphs = paragraphs;
+    paragraphs = mem_realloc(
+        layout->spare_paragraphs, capacity * sizeof(DBGP_TextParagraph));
+    if (paragraphs == NULL) {
+      return false;
+    }
+    layout->spare_paragraphs = paragraphs;
+    layout->paragraphs_capacity = capacity;
+  }
+  return true;
+}
+
+static inline bool is_same_paragraph(
+    const DBGP_TextParagraph* old, Uint64 hash, Uint32 length, Uint8 colors) {
+  return old->hash == hash && old->length == length &&
+         old->start_colors == colors;
+}
+
+bool DBGP_UpdateTextLayout(
+    DBGP_TextLayout* layout, const char* str, int width, Uint8 colors) {
+  if (layout == NULL || layout->font == NULL || str == NULL) {
+    return false;
+  }
+
+  // the previous layout is kept in the spare buffers while the new one is
+  // built, so that unchanged paragraphs can be copied from it
+  DBGP_TextLine* old_lines = layout->lines;
+  DBGP_TextParagraph* old_paragraphs = layout->paragraphs;
+  int nb_old_paragraphs = layout->nb_paragraphs;
+  if (width != layout->width || colors != layout->colors) {
+    nb_old_paragraphs = 0;
+  }
+  layout->lines = layout->spare_lines;
+  layout->paragraphs = layout->spare_paragraphs;
+  layout->spare_lines = old_lines;
+  layout->spare_paragraphs = old_paragraphs;
+
+  layout->text = str;
+  layout->width = width;
+  layout->colors = colors;
+  layout->nb_lines = 0;
+  layout->nb_paragraphs = 0;
+  layout->nb_paragraphs_laid_out = 0;
+
+  const int max_cells = SDL_max(width / layout->font->glyph_width, 1);
+  const char* ptr = str;
+  int old = 0;
+  for (;;) {
+    const char* end = ptr;
+    while (*end != '\0' && *end != '\n') {
+      end++;
+    }
+    const Uint32 length = end - ptr;
+    const Uint64 hash = hash_bytes(HASH_INIT, ptr, length);
+
+    if (!grow_text_layout(
+            layout, layout->nb_lines, layout->nb_paragraphs + 1)) {
+      return false;
+    }
+    old_lines = layout->spare_lines;
+    old_paragraphs = layout->spare_paragraphs;
+    DBGP_TextParagraph* paragraph = &layout->paragraphs[layout->nb_paragraphs];
+    paragraph->hash = hash;
+    paragraph->offset = ptr - str;
+    paragraph->length = length;
+    paragraph->first_line = layout->nb_lines;
+    paragraph->start_colors = colors;
+
+    // match the paragraph with the next old ones, to handle edits as well as
+    // insertions and deletions of paragraphs
+    const DBGP_TextParagraph* match = NULL;
+    for (int i = old; i < SDL_min(old + 2, nb_old_paragraphs); i++) {
+      if (is_same_paragraph(&old_paragraphs[i], hash, length, colors)) {
+        match = &old_paragraphs[i];
+        old = i + 1;
+        break;
+      }
+    }
+
+    if (match != NULL) {
+      if (!grow_text_layout(
+              layout, layout->nb_lines + match->nb_lines,
+              layout->nb_paragraphs + 1)) {
+        return false;
+      }
+      old_lines = layout->spare_lines;
+      for (Uint32 i = 0; i < match->nb_lines; i++) {
+        DBGP_TextLine* line = &layout->lines[layout->nb_lines++];
+        *line = old_lines[match->first_line + i];
+        line->offset = line->offset - match->offset + paragraph->offset;
+      }
+      colors = match->end_colors;
+      ptr = end;
+    } else {
+      bool last = false;
+      while (!last) {
+        if (!grow_text_layout(
+                layout, layout->nb_lines + 1, layout->nb_paragraphs + 1)) {
+          return false;
+        }
+        DBGP_TextLine* line = &layout->lines[layout->nb_lines++];
+        line->offset = ptr - str;
+        line->colors = colors;
+        int nb_glyphs = 0;
+        int nb_cells = 0;
+        last = wrap_line(
+            &ptr, &colors, max_cells, layout->flags, &nb_glyphs, &nb_cells);
+        line->nb_glyphs = nb_glyphs;
+        line->nb_cells = nb_cells;
+      }
+      // wrap_line stops after the newline
+      ptr = end;
+      layout->nb_paragraphs_laid_out++;
+    }
+
+    paragraph = &layout->paragraphs[layout->nb_paragraphs++];
+    paragraph->nb_lines = layout->nb_lines - paragraph->first_line;
+    paragraph->end_colors = colors;
+
+    if (*end == '\0') {
+      break;
+    }
+    ptr = end + 1;
+  }
+
+  return true;
+}
+
+bool DBGP_RenderTextLayout(
+    DBGP_TextLayout* layout, SDL_Renderer* renderer, int x, int y) {
+  if (layout == NULL || layout->font == NULL || layout->font->tex == NULL ||
+      layout->text == NULL || renderer == NULL) {
+    return false;
+  }
+  if (!check_not_recording(renderer)) {
+    return false;
+  }
+
+  DBGP_Font* font = layout->font;
+  if (!begin_batch(renderer)) {
+    return false;
+  }
+  for (int i = 0; i < layout->nb_lines; i++) {
+    const DBGP_TextLine* line = &layout->lines[i];
+    draw_color_run(
+        font,
+        get_aligned_x(font, x, layout->width, layout->flags, line->nb_cells),
+        y + i * font->glyph_height, line->colors, layout->text + line->offset,
+        line->nb_glyphs);
+  }
+  end_batch();
+
+  return true;
+}
+
+bool DBGP_CreateTextView(
+    DBGP_TextView* view, DBGP_Font* font, Uint8 colors,
+    Uint8 highlight_colors) {
+  if (view == NULL || font == NULL) {
+    return false;
+  }
+  SDL_memset(view, 0, sizeof(*view));
+  view->font = font;
+  view->colors = colors;
+  view->highlight_colors = highlight_colors;
+  return true;
+}
+
+void DBGP_DestroyTextView(DBGP_TextView* view) {
+  if (view == NULL) {
+    return;
+  }
+  mem_free(view->lines);
+  mem_free(view->matches);
+  SDL_memset(view, 0, sizeof(*view));
+}
+
+static bool grow_text_view(DBGP_TextView* view, int nb_lines) {
+  if (nb_lines <= view->lines_capacity) {
+    return true;
+  }
+  if (view->lines_capacity > SDL_MAX_SINT32 / 2) {
+    return SDL_SetError("Too many lines in text view");
+  }
+  const int capacity = SDL_max(view->lines_capacity * 2, 1024);
+  Uint32* lines = mem_realloc(view->lines, capacity * sizeof(Uint32));
+  if (lines == NULL) {
+    return false;
+  }
+  view->lines = lines;
+  int* matches = mem_realloc(view->matches, capacity * sizeof(int));
+  if (matches == NULL) {
+    return false;
+  }
+  view->matches = matches;
+  view->lines_capacity = capacity;
+  return true;
+}
+
+// Returns the offset of the end of a line of a text view, line ending
+// excluded.
+static inline size_t get_view_line_end(const DBGP_TextView* view, int line) {
+  const size_t start = view->lines[line];
+  size_t end = view->lines[line + 1] - 1;
+  if (end > start && view->text[end - 1] == '\r') {
+    end--;
+  }
+  return end;
+}
+
+// Returns the first occurrence of c in [ptr, end), or NULL. This is the only
+// call to the C library (see DBGP_USE_LIBC_MEMCHR), as SDL has no SDL_memchr.
+static inline const char* find_byte(const char* ptr, const char* end, char c) {
+#if DBGP_USE_LIBC_MEMCHR
+  return memchr(ptr, c, end - ptr);
+#else
+  for (; ptr < end; ptr++) {
+    if (*ptr == c) {
+      return ptr;
+    }
+  }
+  return NULL;
+#endif
+}
+
+// Returns the first occurrence of needle (len > 0 bytes) in [ptr, end), or
+// NULL. Candidates are found with find_byte and verified with SDL_memcmp.
+static const char* find_substring(
+    const char* ptr, const char* end, const char* needle, size_t len) {
+  while ((size_t) (end - ptr) >= len) {
+    const char* p = find_byte(ptr, end - len + 1, needle[0]);
+    if (p == NULL) {
+      return NULL;
+    }
+    if (SDL_memcmp(p + 1, needle + 1, len - 1) == 0) {
+      return p;
+    }
+    ptr = p + 1;
+  }
+  return NULL;
+}
+
+// Finds the lines matching the filter by scanning the whole text.
+static void match_text_view(DBGP_TextView* view) {
+  view->nb_matches = 0;
+  if (view->filter_length == 0) {
+    for (int i = 0; i < view->nb_lines; i++) {
+      view->matches[i] = i;
+    }
+    view->nb_matches = view->nb_lines;
+    return;
+  }
+
+  const char* text = view->text;
+  size_t offset = 0;
+  int line = 0;
+  while (offset < view->length) {
+    const char* match = find_substring(
+        text + offset, text + view->length, view->filter,
+        view->filter_length);
+    if (match == NULL) {
+      break;
+    }
+    const size_t pos = match - text;
+    while (view->lines[line + 1] <= pos) {
+      line++;
+    }
+    if (pos + view->filter_length <= get_view_line_end(view, line)) {
+      // the rest of the line doesn't need to be searched
+      view->matches[view->nb_matches++] = line;
+      offset = view->lines[++line];
+    } else {
+      offset = pos + 1;
+    }
+  }
+}
+
+// Keeps the matching lines still matching a longer filter.
+static void refine_text_view(DBGP_TextView* view) {
+  int nb_matches = 0;
+  for (int i = 0; i < view->nb_matches; i++) {
+    const int line = view->matches[i];
+    if (find_substring(
+            view->text + view->lines[line],
+            view->text + get_view_line_end(view, line), view->filter,
+            view->filter_length) != NULL) {
+      view->matches[nb_matches++] = line;
+    }
+  }
+  view->nb_matches = nb_matches;
+}
+
+bool DBGP_SetTextViewText(
+    DBGP_TextView* view, const char* text, size_t length) {
+  if (view == NULL || (text == NULL && length > 0)) {
+    return false;
+  }
+  if (length >= SDL_MAX_UINT32) {
+    return SDL_SetError("Text too long for a text view");
+  }
+  view->text = NULL;
+  view->length = 0;
+  view->nb_lines = 0;
+  view->nb_matches = 0;
+
+  // the last offset is the one after the end of the last line
+  int nb_lines = 0;
+  size_t offset = 0;
+  for (;;) {
+    if (!grow_text_view(view, nb_lines + 1)) {
+      return false;
+    }
+    view->lines[nb_lines] = (Uint32) offset;
+    if (offset >= length) {
+      break;
+    }
+    nb_lines++;
+    const char* newline = find_byte(text + offset, text + length, '\n');
+    offset = newline != NULL ? (size_t) (newline - text) + 1 : length + 1;
+  }
+
+  view->text = text;
+  view->length = length;
+  view->nb_lines = nb_lines;
+  match_text_view(view);
+  return true;
+}
+
+bool DBGP_FilterTextView(DBGP_TextView* view, const char* filter) {
+  if (view == NULL) {
+    return false;
+  }
+  if (filter == NULL) {
+    filter = "";
+  }
+  const size_t len = SDL_strlen(filter);
+  if (len >= DBGP_TEXT_VIEW_FILTER_SIZE) {
+    return SDL_SetError("Text view filter too long");
+  }
+  if (SDL_strchr(filter, '\n') != NULL) {
+    return SDL_SetError("Text view filters can't contain newlines");
+  }
+
+  const bool refine =
+      view->filter_length > 0 && len >= view->filter_length &&
+      SDL_memcmp(filter, view->filter, view->filter_length) == 0;
+  SDL_memcpy(view->filter, filter, len + 1);
+  view->filter_length = len;
+  if (view->text == NULL) {
+    return true;
+  }
+  if (refine) {
+    refine_text_view(view);
+  } else {
+    match_text_view(view);
+  }
+  return true;
+}
+
+// Queues a line of a text view, clipped at max_x, with the occurrences of
+// the filter highlighted.
+static void draw_text_view_line(
+    const DBGP_TextView* view, int line, int x, int y, int max_x) {
+  DBGP_Font* font = view->font;
+  const char* ptr = view->text + view->lines[line];
+  const char* end = view->text + get_view_line_end(view, line);
+  const size_t len = view->filter_length;
+  const char* match =
+      len > 0 ? find_substring(ptr, end, view->filter, len) : NULL;
+
+  int ix = x;
+  int prev_width = 0;
+  while (ptr < end) {
+    if (match != NULL && ptr >= match + len) {
+      match = find_substring(ptr, end, view->filter, len);
+    }
+    const Uint8 colors = match != NULL && ptr >= match
+                             ? view->highlight_colors
+                             : view->colors;
+    size_t left = end - ptr;
+    const Uint32 cp = SDL_StepUTF8(&ptr, &left);
+    if (cp == 0) {
+      break;
+    }
+    if (cp >= 256 && cp == SDL_INVALID_UNICODE_CODEPOINT) {
+      continue;
+    }
+
+    if (ix + get_codepoint_width(cp) * font->glyph_width > max_x) {
+      break;
+    }
+    ix += draw_color_text_glyph(NULL, font, ix, y, &prev_width, cp, colors);
+  }
+}
+
+bool DBGP_RenderTextView(
+    DBGP_TextView* view, SDL_Renderer* renderer, const SDL_Rect* box,
+    int first) {
+  if (view == NULL || view->font == NULL || view->font->tex == NULL ||
+      renderer == NULL || box == NULL) {
+    return false;
+  }
+  if (!check_not_recording(renderer)) {
+    return false;
+  }
+
+  const DBGP_Font* font = view->font;
+  const int nb_visible = box->h / font->glyph_height;
+  first = SDL_max(first, 0);
+  if (!begin_batch(renderer)) {
+    return false;
+  }
+  for (int i = 0; i < nb_visible && first + i < view->nb_matches; i++) {
+    draw_text_view_line(
+        view, view->matches[first + i], box->x,
+        box->y + i * font->glyph_height, box->x + box->w);
+  }
+  end_batch();
+
+  return true;
+}
+
+// Blends src over dst, using SDL_BLENDMODE_BLEND equations.
+static inline Uint32 blend_pixel(
+    Uint32 dst, SDL_Color src, const SDL_PixelFormatDetails* details) {
+  const Uint32 a = src.a;
+  const Uint32 inv_a = 255 - a;
+  Uint32 dr = (dst & details->Rmask) >> details->Rshift;
+  Uint32 dg = (dst & details->Gmask) >> details->Gshift;
+  Uint32 db = (dst & details->Bmask) >> details->Bshift;
+  Uint32 da = details->Amask ? (dst & details->Amask) >> details->Ashift : 255;
+  dr = (src.r * a + dr * inv_a + 127) / 255;
+  dg = (src.g * a + dg * inv_a + 127) / 255;
+  db = (src.b * a + db * inv_a + 127) / 255;
+  da = a + (da * inv_a + 127) / 255;
+  return dr << details->Rshift | dg << details->Gshift | db << details->Bshift |
+         (details->Amask ? da << details->Ashift : 0);
+}
+
+#define M 0xffffffff
+// pixel masks of the 4 pixels represented by each nibble of a glyph row
+static const Uint32 nibble_masks[16][4] = {
+    {0, 0, 0, 0}, {0, 0, 0, M}, {0, 0, M, 0}, {0, 0, M, M},
+    {0, M, 0, 0}, {0, M, 0, M}, {0, M, M, 0}, {0, M, M, M},
+    {M, 0, 0, 0}, {M, 0, 0, M}, {M, 0, M, 0}, {M, 0, M, M},
+    {M, M, 0, 0}, {M, M, 0, M}, {M, M, M, 0}, {M, M, M, M},
+};
+#undef M
+
+// Draws one glyph into a locked 32-bit surface. Each nibble of a glyph row is
+// expanded into 4 pixel masks, so that opaque text is drawn with selects
+// instead of branches. Translucent colors are blended pixel by pixel.
+static void blit_glyph(
+    const DBGP_Font* font, SDL_Surface* surface, const SDL_Rect* clip,
+    const SDL_PixelFormatDetails* details, const unsigned char* bits, int x,
+    int y, SDL_Color bg_color, SDL_Color fg_color, Uint32 bg, Uint32 fg) {
+  const int x0 = SDL_max(clip->x - x, 0);
+  const int x1 = SDL_min(clip->x + clip->w - x, font->glyph_width);
+  const int y0 = SDL_max(clip->y - y, 0);
+  const int y1 = SDL_min(clip->y + clip->h - y, font->glyph_height);
+  if (x0 >= x1 || y0 >= y1) {
+    return;
+  }
+
+  for (int row = y0; row < y1; row++) {
+    Uint32* dst = (Uint32*) ((Uint8*) surface->pixels +
+                             (size_t) (y + row) * surface->pitch) +
+                  x;
+    const Uint32 byte = bits != NULL ? bits[row] : 0;
+
+    if (bg_color.a == 255 && fg_color.a == 255 && x0 == 0 && x1 == 8) {
+      const Uint32* hi = nibble_masks[byte >> 4];
+      const Uint32* lo = nibble_masks[byte & 0xf];
+      for (int col = 0; col < 4; col++) {
+        dst[col] = (fg & hi[col]) | (bg & ~hi[col]);
+        dst[col + 4] = (fg & lo[col]) | (bg & ~lo[col]);
+      }
+    } else if (bg_color.a == 255 && fg_color.a == 255) {
+      for (int col = x0; col < x1; col++) {
+        const Uint32 mask = 0u - ((byte >> (7 - col)) & 1);
+        dst[col] = (fg & mask) | (bg & ~mask);
+      }
+    } else if (bg_color.a == 0 && fg_color.a == 255 && x0 == 0 && x1 == 8) {
+      const Uint32* hi = nibble_masks[byte >> 4];
+      const Uint32* lo = nibble_masks[byte & 0xf];
+      for (int col = 0; col < 4; col++) {
+        dst[col] = (fg & hi[col]) | (dst[col] & ~hi[col]);
+        dst[col + 4] = (fg & lo[col]) | (dst[col + 4] & ~lo[col]);
+      }
+    } else if (bg_color.a == 0 && fg_color.a == 255) {
+      for (int col = x0; col < x1; col++) {
+        const Uint32 mask = 0u - ((byte >> (7 - col)) & 1);
+        dst[col] = (fg & mask) | (dst[col] & ~mask);
+      }
+    } else {
+      for (int col = x0; col < x1; col++) {
+        if (bg_color.a != 0) {
+          dst[col] = blend_pixel(dst[col], bg_color, details);
+        }
+        if (((byte >> (7 - col)) & 1) && fg_color.a != 0) {
+          dst[col] = blend_pixel(dst[col], fg_color, details);
+        }
+      }
+    }
+  }
+}
+
+// Shared implementation of the *ToSurface functions: colors is used (and
+// escape codes are parsed) when bg_color and fg_color are NULL.
+static bool print_to_surface(
+    DBGP_Font* font, SDL_Surface* surface, int x, int y,
+    const SDL_Color* bg_color, const SDL_Color* fg_color, Uint8 colors,
+    const char* str) {
+  if (font == NULL || font->raw_data == NULL || surface == NULL ||
+      str == NULL) {
+    return false;
+  }
+  if (SDL_BYTESPERPIXEL(surface->format) != 4) {
+    return SDL_SetError(
+        "Unsupported surface format %s",
+        SDL_GetPixelFormatName(surface->format));
+  }
+  const SDL_PixelFormatDetails* details =
+      SDL_GetPixelFormatDetails(surface->format);
+  if (details == NULL) {
+    return false;
+  }
+  SDL_Rect clip;
+  if (!SDL_GetSurfaceClipRect(surface, &clip)) {
+    return false;
+  }
+  if (SDL_MUSTLOCK(surface) && !SDL_LockSurface(surface)) {
+    return false;
+  }
+
+  text_cursor cursor;
+  init_text_cursor(&cursor, str, x, y, colors);
+  SDL_Color bg = {0, 0, 0, 0};
+  SDL_Color fg = {0, 0, 0, 0};
+  if (bg_color != NULL && fg_color != NULL) {
+    bg = *bg_color;
+    fg = *fg_color;
+  }
+  Uint32 bg_pixel = SDL_MapSurfaceRGBA(surface, bg.r, bg.g, bg.b, bg.a);
+  Uint32 fg_pixel = SDL_MapSurfaceRGBA(surface, fg.r, fg.g, fg.b, fg.a);
+  int current_colors = -1;
+
+  Uint32 cp = 0;
+  while ((cp = bg_color ? SDL_StepUTF8(&cursor.ptr, NULL)
+                        : step_text_cursor(&cursor, font)) != 0) {
+    if (cp >= 256 && cp == SDL_INVALID_UNICODE_CODEPOINT) {
+      continue;
+    }
+
+    if (cp == '\n') {
+      cursor.iy += font->glyph_height;
+      cursor.ix = x;
+      cursor.prev_width = 0;
+      continue;
+    }
+
+    if (bg_color == NULL && current_colors != cursor.colors) {
+      current_colors = cursor.colors;
+      Uint32 bg_rgb = color_palette[cursor.colors >> 4];
+      Uint32 fg_rgb = color_palette[cursor.colors & 0xf];
+      bg.r = (bg_rgb >> 16) & 0xff;
+      bg.g = (bg_rgb >> 8) & 0xff;
+      bg.b = bg_rgb & 0xff;
+      bg.a = bg_rgb != 0 ? 0xff : 0;
+      fg.r = (fg_rgb >> 16) & 0xff;
+      fg.g = (fg_rgb >> 8) & 0xff;
+      fg.b = fg_rgb & 0xff;
+      fg.a = 0xff;
+      bg_pixel = SDL_MapSurfaceRGBA(surface, bg.r, bg.g, bg.b, bg.a);
+      fg_pixel = SDL_MapSurfaceRGBA(surface, fg.r, fg.g, fg.b, fg.a);
+    }
+    // same layout as draw_text_glyph
+    const int width = get_codepoint_width(cp);
+    Uint32 glyph = 0;
+    const DBGP_Font* owner = resolve_glyph(font, cp, &glyph);
+    const unsigned char* bits =
+        owner != NULL && owner->raw_data != NULL
+            ? &owner->raw_data[(size_t) glyph * owner->glyph_height]
+            : NULL;
+    if (width == 0) {
+      if (cursor.prev_width == 0) {
+        continue;
+      }
+      const SDL_Color transparent = {0, 0, 0, 0};
+      blit_glyph(
+          font, surface, &clip, details, bits,
+          cursor.ix - cursor.prev_width * font->glyph_width, cursor.iy,
+          transparent, fg, 0, fg_pixel);
+      continue;
+    }
+    cursor.prev_width = width;
+    blit_glyph(
+        font, surface, &clip, details, bits, cursor.ix, cursor.iy, bg, fg,
+        bg_pixel, fg_pixel);
+    cursor.ix += font->glyph_width;
+    if (width == 2) {
+      const unsigned char* right_bits =
+          bits != NULL && is_wide_glyph(owner, glyph)
+              ? bits + owner->glyph_height
+              : NULL;
+      blit_glyph(
+          font, surface, &clip, details, right_bits, cursor.ix, cursor.iy, bg,
+          fg, bg_pixel, fg_pixel);
+      cursor.ix += font->glyph_width;
+    }
+  }
 
-  font->glyph_width = GLYPH_WIDTH;
-  font->glyph_height = glyph_height;
-  font->nb_glyphs = raw_data_len / font->glyph_height;
+  if (SDL_MUSTLOCK(surface)) {
+    SDL_UnlockSurface(surface);
+  }
 
-  SDL_Surface* surface = SDL_CreateSurface(
-      GLYPHS_PER_LINE * GLYPH_WIDTH,
-      font->nb_glyphs / GLYPHS_PER_LINE * font->glyph_height,
-      SDL_PIXELFORMAT_INDEX1LSB);
-  if (!surface) {
-    return false;
+  return true;
+}
+
+bool DBGP_PrintToSurface(
+    DBGP_Font* font, SDL_Surface* surface, int x, int y, SDL_Color bg_color,
+    SDL_Color fg_color, const char* str) {
+  return print_to_surface(font, surface, x, y, &bg_color, &fg_color, 0, str);
+}
+
+bool DBGP_ColorPrintToSurface(
+    DBGP_Font* font, SDL_Surface* surface, int x, int y, Uint8 colors,
+    const char* str) {
+  return print_to_surface(font, surface, x, y, NULL, NULL, colors, str);
+}
+
+enum {
+  ANSI_STATE_GROUND,
+  ANSI_STATE_ESCAPE,
+  ANSI_STATE_CHARSET,
+  ANSI_STATE_CSI,
+  ANSI_STATE_STRING,
+};
+
+// maps ANSI color numbers (red = 1, green = 2...) onto the CGA palette
+static const Uint8 ansi_to_cga[8] = {0, 4, 2, 6, 1, 5, 3, 7};
+
+static Uint8 get_nearest_color(Uint8 r, Uint8 g, Uint8 b) {
+  Uint8 nearest = 0;
+  int nearest_distance = 0x7fffffff;
+  for (Uint8 i = 0; i < 16; i++) {
+    int dr = (int) ((color_palette[i] >> 16) & 0xff) - r;
+    int dg = (int) ((color_palette[i] >> 8) & 0xff) - g;
+    int db = (int) (color_palette[i] & 0xff) - b;
+    int distance = dr * dr + dg * dg + db * db;
+    if (distance < nearest_distance) {
+      nearest_distance = distance;
+      nearest = i;
+    }
   }
-  SDL_Palette* palette = SDL_CreatePalette(2);
-  if (!palette) {
+  return nearest;
+}
+
+// maps the color n of the 256 color palette of xterm onto the CGA palette
+static void get_indexed_color(int n, Uint8* c) {
+  if (n < 16) {
+    *c = ansi_to_cga[n & 7] | (n & 8);
+  } else if (n < 232) {
+    static const Uint8 levels[6] = {0, 95, 135, 175, 215, 255};
+    n -= 16;
+    *c = get_nearest_color(levels[n / 36], levels[n / 6 % 6], levels[n % 6]);
+  } else if (n < 256) {
+    Uint8 level = 8 + (n - 232) * 10;
+    *c = get_nearest_color(level, level, level);
+  }
+}
+
+// maps a 24-bit color onto the CGA palette, components above 255 being
+// clamped
+static void get_rgb_color(const int* rgb, Uint8* c) {
+  *c = get_nearest_color(
+      (Uint8) SDL_min(rgb[0], 255), (Uint8) SDL_min(rgb[1], 255),
+      (Uint8) SDL_min(rgb[2], 255));
+}
+
+// parses the color of a "38;5;n" or "38;2;r;g;b" sequence, or of the
+// "38:5:n" and "38:2:[color space]:r:g:b" forms using sub-parameters, and
+// returns the number of parameters consumed after the "38"
+static int get_extended_color(const DBGP_ANSIStream* stream, int i, Uint8* c) {
+  const int* params = stream->params;
+  if (i + 1 < stream->nb_params && stream->subparams[i + 1]) {
+    // the sub-parameters all belong to the color: malformed ones are
+    // skipped without changing it
+    int n = 1;
+    while (i + n + 1 < stream->nb_params && stream->subparams[i + n + 1]) {
+      n++;
+    }
+    if (params[i + 1] == 5 && n >= 2) {
+      get_indexed_color(params[i + 2], c);
+    } else if (params[i + 1] == 2 && n >= 5) {
+      get_rgb_color(&params[i + 3], c);
+    } else if (params[i + 1] == 2 && n == 4) {
+      // without the color space, as some terminals write it
+      get_rgb_color(&params[i + 2], c);
+    }
+    return n;
+  }
+  if (i + 2 < stream->nb_params && params[i + 1] == 5) {
+    get_indexed_color(params[i + 2], c);
+    return 2;
+  }
+  if (i + 4 < stream->nb_params && params[i + 1] == 2) {
+    get_rgb_color(&params[i + 2], c);
+    return 4;
+  }
+  return stream->nb_params - i - 1;
+}
+
+static void update_ansi_colors(DBGP_ANSIStream* stream) {
+  Uint8 fg = stream->fg;
+  Uint8 bg = stream->bg;
+  if (stream->bold && fg < 8) {
+    fg |= 8;
+  }
+  if (stream->reverse) {
+    Uint8 tmp = fg;
+    fg = bg;
+    bg = tmp;
+  }
+  stream->colors = (bg & 0xf) << 4 | (fg & 0xf);
+}
+
+static void select_graphic_rendition(DBGP_ANSIStream* stream) {
+  if (stream->nb_params == 0) {
+    stream->params[0] = 0;
+    stream->subparams[0] = false;
+    stream->nb_params = 1;
+  }
+
+  for (int i = 0; i < stream->nb_params; i++) {
+    int p = stream->params[i];
+    if (stream->subparams[i]) {
+      // sub-parameters of an attribute that isn't supported ("4:3", or a
+      // "58:2::r:g:b" underline color) mustn't be read as attributes
+      continue;
+    }
+    if (p == 0) {
+      stream->fg = stream->default_colors & 0xf;
+      stream->bg = stream->default_colors >> 4;
+      stream->bold = false;
+      stream->reverse = false;
+    } else if (p == 1) {
+      stream->bold = true;
+    } else if (p == 22) {
+      stream->bold = false;
+    } else if (p == 7) {
+      stream->reverse = true;
+    } else if (p == 27) {
+      stream->reverse = false;
+    } else if (p >= 30 && p <= 37) {
+      stream->fg = ansi_to_cga[p - 30];
+    } else if (p == 38) {
+      i += get_extended_color(stream, i, &stream->fg);
+    } else if (p == 39) {
+      stream->fg = stream->default_colors & 0xf;
+    } else if (p >= 40 && p <= 47) {
+      stream->bg = ansi_to_cga[p - 40];
+    } else if (p == 48) {
+      i += get_extended_color(stream, i, &stream->bg);
+    } else if (p == 49) {
+      stream->bg = stream->default_colors >> 4;
+    } else if (p >= 90 && p <= 97) {
+      stream->fg = ansi_to_cga[p - 90] | 8;
+    } else if (p >= 100 && p <= 107) {
+      stream->bg = ansi_to_cga[p - 100] | 8;
+    }
+  }
+
+  update_ansi_colors(stream);
+}
+
+static void dispatch_control_sequence(DBGP_ANSIStream* stream, char final) {
+  // most cursor movements default to 1 when no parameter is given
+  int n = stream->nb_params > 0 && stream->params[0] > 0 ? stream->params[0]
+                                                         : 1;
+  if (final != 'm') {
+    stream->prev_width = 0;
+  }
+  switch (final) {
+  case 'm': select_graphic_rendition(stream); break;
+  case 'A': stream->line = SDL_max(stream->line - n, 0); break;
+  case 'B': stream->line += n; break;
+  case 'C': stream->column += n; break;
+  case 'D': stream->column = SDL_max(stream->column - n, 0); break;
+  case 'G':
+  case '`': stream->column = n - 1; break;
+  case 'H':
+  case 'f':
+    stream->line = n - 1;
+    stream->column = stream->nb_params > 1 && stream->params[1] > 0
+                         ? stream->params[1] - 1
+                         : 0;
+    break;
+  }
+}
+
+static inline void draw_ansi_glyph(DBGP_ANSIStream* stream, Uint32 cp) {
+  DBGP_Font* font = stream->font;
+  // wide codepoints take two columns, as in terminals
+  const int advance = draw_color_text_glyph(
+      NULL, font, stream->x + stream->column * font->glyph_width,
+      stream->y + stream->line * font->glyph_height, &stream->prev_width, cp,
+      stream->colors);
+  stream->column += advance / font->glyph_width;
+}
+
+// Queues the run of printable ASCII characters starting at ptr, and returns
+// the first byte after it. The characters of a run are one cell wide and
+// share the colors of the stream, so these are converted once per run, and
+// the glyphs of a font without fallbacks nor codepoint table are the
+// characters themselves.
+static const Uint8* draw_ansi_ascii_run(
+    DBGP_ANSIStream* stream, const Uint8* ptr, const Uint8* end) {
+  DBGP_Font* font = stream->font;
+  const bool has_bg = stream->colors >> 4 != 0;
+  const SDL_FColor bg = get_palette_color(stream->colors >> 4);
+  const SDL_FColor fg = get_palette_color(stream->colors & 0xf);
+  const bool direct = font->nb_fallbacks == 0 && font->codepoints == NULL &&
+                      font->nb_glyphs > 0x7e && font->atlas.nb_pages > 0;
+  const float y = stream->y + stream->line * font->glyph_height;
+  float x = stream->x + stream->column * font->glyph_width;
+  const Uint8* start = ptr;
+  for (; ptr < end && *ptr >= 0x20 && *ptr < 0x7f; ptr++) {
+    if (has_bg) {
+      draw_rect(x, y, font->glyph_width, font->glyph_height, bg);
+    }
+    if (direct) {
+      queue_glyph(font, font->style, *ptr, x, y, fg);
+    } else {
+      Uint32 glyph = 0;
+      const DBGP_Font* owner = resolve_glyph(font, *ptr, &glyph);
+      draw_resolved_glyph(NULL, font, owner, glyph, x, y, fg);
+    }
+    x += font->glyph_width;
+  }
+  if (ptr > start) {
+    stream->column += (int) (ptr - start);
+    stream->prev_width = 1;
+  }
+  return ptr;
+}
+
+void DBGP_InitANSIStream(
+    DBGP_ANSIStream* stream, DBGP_Font* font, int x, int y, Uint8 colors) {
+  if (stream == NULL) {
+    return;
+  }
+  SDL_memset(stream, 0, sizeof(*stream));
+  stream->font = font;
+  stream->x = x;
+  stream->y = y;
+  stream->default_colors = colors;
+  stream->fg = colors & 0xf;
+  stream->bg = colors >> 4;
+  stream->state = ANSI_STATE_GROUND;
+  update_ansi_colors(stream);
+}
+
+bool DBGP_WriteANSI(
+    DBGP_ANSIStream* stream, SDL_Renderer* renderer, const void* data,
+    size_t len) {
+  if (stream == NULL || stream->font == NULL || stream->font->tex == NULL ||
+      renderer == NULL || (data == NULL && len > 0)) {
     return false;
   }
-  SDL_Color colors[2] = {{0, 0, 0, 0}, {255, 255, 255, 255}};
-  if (!SDL_SetPaletteColors(palette, colors, 0, 2)) {
+  if (!check_not_recording(renderer)) {
     return false;
   }
-  if (!SDL_SetSurfacePalette(surface, palette)) {
+
+  DBGP_Font* font = stream->font;
+  if (!begin_batch(renderer)) {
     return false;
   }
+  const Uint8* ptr = data;
+  const Uint8* end = ptr + len;
+  while (ptr < end) {
+    Uint8 c = *ptr++;
+    Uint32 cp = 0;
+
+    switch (stream->state) {
+    case ANSI_STATE_GROUND:
+      if (stream->utf8_remaining > 0) {
+        if ((c & 0xc0) == 0x80) {
+          stream->codepoint = stream->codepoint << 6 | (c & 0x3f);
+          if (--stream->utf8_remaining > 0) {
+            continue;
+          }
+          cp = stream->codepoint;
+          if (cp < stream->codepoint_min || cp > 0x10ffff ||
+              (cp >= 0xd800 && cp <= 0xdfff)) {
+            continue;
+          }
+          break;
+        }
+        // truncated sequence: drop it and handle the byte normally
+        stream->utf8_remaining = 0;
+      }
+      if (c >= 0x80) {
+        if ((c & 0xe0) == 0xc0) {
+          stream->codepoint = c & 0x1f;
+          stream->codepoint_min = 0x80;
+          stream->utf8_remaining = 1;
+        } else if ((c & 0xf0) == 0xe0) {
+          stream->codepoint = c & 0x0f;
+          stream->codepoint_min = 0x800;
+          stream->utf8_remaining = 2;
+        } else if ((c & 0xf8) == 0xf0) {
+          stream->codepoint = c & 0x07;
+          stream->codepoint_min = 0x10000;
+          stream->utf8_remaining = 3;
+        }
+        continue;
+      }
+      if (c >= 0x20 && c != 0x7f) {
+        cp = c;
+        break;
+      }
+      switch (c) {
+      case 0x1b: stream->state = ANSI_STATE_ESCAPE; continue;
+      case '\r': stream->column = 0; break;
+      case '\n':
+        stream->column = 0;
+        stream->line++;
+        break;
+      case '\b': stream->column = SDL_max(stream->column - 1, 0); break;
+      case '\t': stream->column = (stream->column / 8 + 1) * 8; break;
+      default: continue;
+      }
+      // combining marks only follow a codepoint drawn before the cursor
+      stream->prev_width = 0;
+      continue;
 
-  const int bytes_per_glyph = 1 * font->glyph_height;
-  for (size_t i = 0; i < raw_data_len; i++) {
-    const unsigned char* ptr = &raw_data[i];
-    int glyph_no = i / bytes_per_glyph;
-    int glyph_y = (glyph_no / GLYPHS_PER_LINE) * font->glyph_height;
-    int glyph_x = (glyph_no % GLYPHS_PER_LINE) * font->glyph_width;
-    int byte_no_in_glyph = i % bytes_per_glyph;
+    case ANSI_STATE_ESCAPE:
+      switch (c) {
+      case '[':
+        stream->state = ANSI_STATE_CSI;
+        stream->nb_params = 0;
+        break;
+      case ']':
+      case 'P':
+      case 'X':
+      case '^':
+      case '_': stream->state = ANSI_STATE_STRING; break;
+      case '(':
+      case ')':
+      case '*':
+      case '+': stream->state = ANSI_STATE_CHARSET; break;
+      case 'c':
+        DBGP_InitANSIStream(
+            stream, font, stream->x, stream->y, stream->default_colors);
+        break;
+      case 0x1b: break;
+      default: stream->state = ANSI_STATE_GROUND; break;
+      }
+      continue;
 
-    for (int bit = 0; bit < GLYPH_WIDTH; bit++) {
-      bool value = (*ptr >> ((GLYPH_WIDTH - 1) - bit)) & 1;
+    case ANSI_STATE_CHARSET: stream->state = ANSI_STATE_GROUND; continue;
 
-      int x = glyph_x + bit;
-      int y = glyph_y + byte_no_in_glyph;
+    case ANSI_STATE_CSI:
+      if (c >= '0' && c <= '9') {
+        if (stream->nb_params == 0) {
+          stream->params[0] = 0;
+          stream->subparams[0] = false;
+          stream->nb_params = 1;
+        }
+        int* param = &stream->params[stream->nb_params - 1];
+        if (*param < 10000) {
+          *param = *param * 10 + (c - '0');
+        }
+      } else if (c == ';' || c == ':') {
+        if (stream->nb_params == 0) {
+          stream->params[0] = 0;
+          stream->subparams[0] = false;
+          stream->nb_params = 1;
+        }
+        if (stream->nb_params < DBGP_ANSI_MAX_PARAMS) {
+          stream->subparams[stream->nb_params] = c == ':';
+          stream->params[stream->nb_params++] = 0;
+        }
+      } else if (c >= 0x40 && c <= 0x7e) {
+        dispatch_control_sequence(stream, c);
+        stream->state = ANSI_STATE_GROUND;
+      } else if (c == 0x1b) {
+        stream->state = ANSI_STATE_ESCAPE;
+      } else if (c == 0x18 || c == 0x1a) {
+        stream->state = ANSI_STATE_GROUND;
+      }
+      // private markers ("?") and intermediate bytes are ignored
+      continue;
 
-      int position = y * GLYPHS_PER_LINE * GLYPH_WIDTH + x;
-      int byte_position = position / 8;
-      int byte_bit_no = position % 8;
+    case ANSI_STATE_STRING:
+      // OSC, DCS... are skipped until BEL or ST ("ESC \")
+      if (c == 0x07) {
+        stream->state = ANSI_STATE_GROUND;
+      } else if (c == 0x1b) {
+        stream->state = ANSI_STATE_ESCAPE;
+      }
+      continue;
+    }
 
-      Uint8* const target = (Uint8*) surface->pixels + byte_position;
-      *target |= value << byte_bit_no;
+    if (cp < 0x7f) {
+      // fast path for runs of printable ASCII characters (decoded UTF-8
+      // sequences are at least U+0080)
+      ptr = draw_ansi_ascii_run(stream, ptr - 1, end);
+    } else {
+      draw_ansi_glyph(stream, cp);
     }
   }
+  end_batch();
 
-  font->tex = SDL_CreateTextureFromSurface(renderer, surface);
-  if (font->tex == NULL) {
+  return true;
+}
+
+// Commands are aligned on 8 bytes in the recording buffer
+#define COMMAND_ALIGN(size) (((size) + 7) & ~(size_t) 7)
+
+bool DBGP_CreateOverlayCache(
+    DBGP_OverlayCache* cache, SDL_Renderer* renderer, int width, int height,
+    float max_update_rate) {
+  if (cache == NULL || renderer == NULL || width <= 0 || height <= 0) {
     return false;
   }
-  if (!SDL_SetTextureScaleMode(font->tex, SDL_SCALEMODE_NEAREST)) {
-    SDL_Log("Error while setting scale mode: %s", SDL_GetError());
-  }
-  if (!SDL_SetTextureBlendMode(font->tex, SDL_BLENDMODE_BLEND)) {
-    SDL_Log("Error while setting blend mode: %s", SDL_GetError());
+  SDL_memset(cache, 0, sizeof(*cache));
+  cache->texture = SDL_CreateTexture(
+      renderer, SDL_PIXELFORMAT_ARGB8888, SDL_TEXTUREACCESS_TARGET, width,
+      height);
+  if (cache->texture == NULL) {
+    return false;
   }
+  // text is drawn with SDL_BLENDMODE_BLEND on a transparent texture, which
+  // leaves premultiplied colors
+  SDL_SetTextureBlendMode(cache->texture, SDL_BLENDMODE_BLEND_PREMULTIPLIED);
+  SDL_SetTextureScaleMode(cache->texture, SDL_SCALEMODE_NEAREST);
 
-  SDL_DestroySurface(surface);
-  SDL_DestroyPalette(palette);
-
+  cache->renderer = renderer;
+  cache->width = width;
+  cache->height = height;
+  if (max_update_rate > 0) {
+    cache->min_update_interval =
+        (Uint64) (SDL_NS_PER_SECOND / (double) max_update_rate);
+  }
   return true;
 }
 
-void DBGP_DestroyFont(DBGP_Font* font) {
-  if (font == NULL) {
+void DBGP_DestroyOverlayCache(DBGP_OverlayCache* cache) {
+  if (cache == NULL) {
     return;
   }
-  if (font->tex != NULL) {
-    SDL_DestroyTexture(font->tex);
-    font->tex = NULL;
+  if (recording_overlay == cache) {
+    recording_overlay = NULL;
   }
-  font->glyph_width = 0;
-  font->glyph_height = 0;
-  font->nb_glyphs = 0;
+  if (cache->texture != NULL) {
+    SDL_DestroyTexture(cache->texture);
+  }
+  mem_free(cache->commands);
+  SDL_memset(cache, 0, sizeof(*cache));
 }
 
-bool DBGP_Print(
-    DBGP_Font* font, SDL_Renderer* renderer, int x, int y, SDL_Color bg_color,
-    SDL_Color fg_color, const char* str) {
-  if (font == NULL || font->tex == NULL || renderer == NULL) {
-    return false;
+void DBGP_InvalidateOverlayCache(DBGP_OverlayCache* cache) {
+  if (cache != NULL) {
+    cache->cached_hash = 0;
+    cache->last_update = 0;
   }
+}
 
-  Uint8 r = 0, g = 0, b = 0, a = 0;
-  if (!SDL_GetRenderDrawColor(renderer, &r, &g, &b, &a)) {
-    SDL_Log("Error while getting renderer draw color: %s", SDL_GetError());
+bool DBGP_BeginOverlayCache(DBGP_OverlayCache* cache) {
+  if (cache == NULL || cache->texture == NULL) {
+    return false;
   }
+  if (recording_overlay != NULL) {
+    return SDL_SetError("An overlay cache is already recording");
+  }
+  recording_overlay = cache;
+  cache->hash = HASH_INIT;
+  cache->commands_size = 0;
+  return true;
+}
 
-  for (int pass = 0; pass < 2; pass++) {
-    const char* ptr = str;
-    int ix = x;
-    int iy = y;
+static bool record_overlay_command(overlay_command* command, const char* str) {
+  DBGP_OverlayCache* cache = recording_overlay;
+  const size_t length = str != NULL ? SDL_strlen(str) : 0;
+  if (length > SDL_MAX_UINT32) {
+    return SDL_SetError("String too long");
+  }
+  const size_t size = COMMAND_ALIGN(sizeof(*command) + length + 1);
+  command->length = (Uint32) length;
+  command->style = command->font->style;
 
-    if (pass == 0) {
-      SDL_SetRenderDrawColor(
-          renderer, bg_color.r, bg_color.g, bg_color.b, bg_color.a);
-    } else {
-      // SDL_SetRenderDrawColor(renderer, 0xff, 0xff, 0xff, 0xff);
-      SDL_SetTextureAlphaMod(font->tex, fg_color.a);
-      SDL_SetTextureColorMod(font->tex, fg_color.r, fg_color.g, fg_color.b);
+  if (cache->commands_size + size > cache->commands_capacity) {
+    size_t capacity = SDL_max(cache->commands_capacity * 2, 4096);
+    while (capacity < cache->commands_size + size) {
+      capacity *= 2;
+    }
+    Uint8* commands = mem_realloc(cache->commands, capacity);
+    if (commands == NULL) {
+      return false;
     }
+    cache->commands = commands;
+    cache->commands_capacity = capacity;
+  }
 
-    Uint32 cp = 0;
-    while ((cp = SDL_StepUTF8(&ptr, NULL)) != 0) {
-      if (cp >= 256 && cp == SDL_INVALID_UNICODE_CODEPOINT) {
-        continue;
-      }
+  Uint8* dst = &cache->commands[cache->commands_size];
+  SDL_memcpy(dst, command, sizeof(*command));
+  SDL_memcpy(dst + sizeof(*command), str != NULL ? str : "", length + 1);
+  cache->commands_size += size;
 
-      if (cp == '\n') {
-        iy += font->glyph_height;
-        ix = x;
-        continue;
-      }
-      SDL_FRect r = {ix, iy, font->glyph_width, font->glyph_height};
+  // commands are zeroed before being filled, so padding bytes are hashed too
+  cache->hash = hash_bytes(cache->hash, command, sizeof(*command));
+  cache->hash = hash_bytes(cache->hash, str, length);
+  return true;
+}
 
-      if (pass == 0) {
-        // background
-        SDL_RenderFillRect(renderer, &r);
-      } else {
-        // foreground
-        SDL_FRect src = {
-            cp % GLYPHS_PER_LINE * font->glyph_width,
-            cp / GLYPHS_PER_LINE * font->glyph_height, font->glyph_width,
-            font->glyph_height};
-        SDL_RenderTexture(renderer, font->tex, &src, &r);
-      }
+// Draws the recorded commands into the cache texture.
+static bool update_overlay_texture(DBGP_OverlayCache* cache) {
+  // an open batch is drawn on the current target, and put aside meanwhile
+  if (batch.open) {
+    flush_batch();
+  }
+  const glyph_batch open_batch = batch;
+  batch.open = false;
+  // the calls were traced when recorded
+  SDL_IOStream* trace_stream = trace.stream;
+  trace.stream = NULL;
+
+  SDL_Renderer* renderer = cache->renderer;
+  SDL_Texture* target = SDL_GetRenderTarget(renderer);
+  Uint8 r = 0, g = 0, b = 0, a = 0;
+  SDL_BlendMode blend_mode = SDL_BLENDMODE_BLEND;
+  SDL_GetRenderDrawColor(renderer, &r, &g, &b, &a);
+  SDL_GetRenderDrawBlendMode(renderer, &blend_mode);
+  if (!SDL_SetRenderTarget(renderer, cache->texture)) {
+    batch = open_batch;
+    trace.stream = trace_stream;
+    return false;
+  }
+  SDL_SetRenderDrawColor(renderer, 0, 0, 0, 0);
+  SDL_RenderClear(renderer);
+  SDL_SetRenderDrawBlendMode(renderer, SDL_BLENDMODE_BLEND);
 
-      ix += font->glyph_width;
+  size_t offset = 0;
+  while (offset < cache->commands_size) {
+    const overlay_command* command =
+        (const overlay_command*) &cache->commands[offset];
+    const char* str = (const char*) (command + 1);
+    const int style = command->font->style;
+    command->font->style = command->style;
+    switch (command->type) {
+    case OVERLAY_PRINT:
+      DBGP_Print(
+          command->font, renderer, command->box.x, command->box.y,
+          command->bg_color, command->fg_color, str);
+      break;
+    case OVERLAY_COLOR_PRINT:
+      DBGP_ColorPrint(
+          command->font, renderer, command->box.x, command->box.y,
+          command->colors, str);
+      break;
+    case OVERLAY_PRINT_WRAPPED:
+      DBGP_PrintWrapped(
+          command->font, renderer, &command->box, command->colors,
+          command->flags, str);
+      break;
     }
+    command->font->style = style;
+    offset += COMMAND_ALIGN(sizeof(*command) + command->length + 1);
   }
 
-  SDL_SetTextureAlphaMod(font->tex, 255);
+  SDL_SetRenderDrawBlendMode(renderer, blend_mode);
   SDL_SetRenderDrawColor(renderer, r, g, b, a);
-
-  return true;
+  batch = open_batch;
+  trace.stream = trace_stream;
+  return SDL_SetRenderTarget(renderer, target);
 }
 
-static char printf_buffer[DBGP_MAX_STR_LEN];
+bool DBGP_EndOverlayCache(DBGP_OverlayCache* cache) {
+  if (cache == NULL) {
+    return false;
+  }
+  if (recording_overlay != cache) {
+    return SDL_SetError("The overlay cache is not recording");
+  }
+  recording_overlay = NULL;
 
-bool DBGP_Printf(
-    DBGP_Font* font, SDL_Renderer* renderer, int x, int y, SDL_Color bg_color,
-    SDL_Color fg_color, const char* fmt, ...) {
-  va_list args;
-  va_start(args, fmt);
-  SDL_vsnprintf(printf_buffer, DBGP_MAX_STR_LEN, fmt, args);
-  va_end(args);
+  const Uint64 now = SDL_GetTicksNS();
+  if (cache->hash != cache->cached_hash &&
+      (cache->last_update == 0 ||
+       now - cache->last_update >= cache->min_update_interval)) {
+    if (!update_overlay_texture(cache)) {
+      return false;
+    }
+    cache->cached_hash = cache->hash;
+    cache->last_update = now;
+    cache->nb_updates++;
+  }
 
-  return DBGP_Print(font, renderer, x, y, bg_color, fg_color, printf_buffer);
+  const SDL_FRect dst = {0, 0, cache->width, cache->height};
+  return SDL_RenderTexture(cache->renderer, cache->texture, NULL, &dst);
 }
 
-static inline bool is_hex(char c) {
-  return (c >= '0' && c <= '9') || (c >= 'a' && c <= 'f') ||
-         (c >= 'A' && c <= 'F');
+bool DBGP_CreatePerfHUD(
+    DBGP_PerfHUD* hud, int capacity, int graph_width, int graph_height) {
+  if (hud == NULL || capacity <= 0 || graph_width <= 0 || graph_height <= 0) {
+    return false;
+  }
+  SDL_memset(hud, 0, sizeof(*hud));
+  hud->capacity = capacity;
+  hud->graph_width = graph_width;
+  hud->graph_height = graph_height;
+  return true;
 }
 
-static inline Uint8 get_hex_value(char c) {
-  if (c >= '0' && c <= '9') {
-    return c - '0';
+void DBGP_DestroyPerfHUD(DBGP_PerfHUD* hud) {
+  if (hud == NULL) {
+    return;
   }
-  if (c >= 'a' && c <= 'f') {
-    return c - 'a' + 10;
+  for (int i = 0; i < hud->nb_series; i++) {
+    mem_free(hud->series[i].samples);
   }
-  if (c >= 'A' && c <= 'F') {
-    return c - 'A' + 10;
+  SDL_memset(hud, 0, sizeof(*hud));
+}
+
+int DBGP_AddPerfSeries(DBGP_PerfHUD* hud, const char* name, Uint8 colors) {
+  if (hud == NULL || hud->capacity == 0 || name == NULL) {
+    return -1;
   }
-  return 0;
+  if (hud->nb_series == DBGP_PERF_MAX_SERIES) {
+    SDL_SetError("Too many performance series");
+    return -1;
+  }
+  DBGP_PerfSeries* series = &hud->series[hud->nb_series];
+  series->samples = mem_malloc(hud->capacity * sizeof(float));
+  if (series->samples == NULL) {
+    return -1;
+  }
+  SDL_utf8strlcpy(series->name, name, sizeof(series->name));
+  series->colors = colors;
+  series->scale = 0;
+  series->nb_samples = 0;
+  series->next = 0;
+  SDL_memset(&series->stats, 0, sizeof(series->stats));
+  series->stats_outdated = false;
+  return hud->nb_series++;
 }
 
-// CGA 16-color palette
-static const Uint32 color_palette[16] = {
-    0x000000, 0x0000aa, 0x00aa00, 0x00aaaa, 0xaa0000, 0xaa00aa,
-    0xaa5500, 0xaaaaaa, 0x555555, 0x5555ff, 0x55ff55, 0x55ffff,
-    0xff5555, 0xff55ff, 0xffff55, 0xffffff,
-};
+void DBGP_AddPerfSample(DBGP_PerfHUD* hud, int series, float value) {
+  if (hud == NULL || series < 0 || series >= hud->nb_series) {
+    return;
+  }
+  DBGP_PerfSeries* s = &hud->series[series];
+  s->samples[s->next] = value;
+  s->next = s->next + 1 < hud->capacity ? s->next + 1 : 0;
+  if (s->nb_samples < hud->capacity) {
+    s->nb_samples++;
+  }
+  s->stats_outdated = true;
+}
 
-bool DBGP_ColorPrint(
-    DBGP_Font* font, SDL_Renderer* renderer, int x, int y, Uint8 colors,
-    const char* str) {
-  if (font == NULL || font->tex == NULL || renderer == NULL) {
+static int compare_floats(const void* a, const void* b) {
+  const float fa = *(const float*) a;
+  const float fb = *(const float*) b;
+  return (fa > fb) - (fa < fb);
+}
+
+// Returns the sample of rank percent% of n sorted samples (nearest rank).
+static inline float get_percentile(const float* sorted, int n, int percent) {
+  const int rank = (int) (((Sint64) n * percent + 99) / 100);
+  return sorted[rank > 0 ? rank - 1 : 0];
+}
+
+bool DBGP_GetPerfStats(
+    const DBGP_PerfHUD* hud, int series, DBGP_PerfStats* stats) {
+  if (hud == NULL || series < 0 || series >= hud->nb_series ||
+      stats == NULL) {
     return false;
   }
+  SDL_memset(stats, 0, sizeof(*stats));
+  const DBGP_PerfSeries* s = &hud->series[series];
+  const int n = s->nb_samples;
+  if (n == 0) {
+    return true;
+  }
 
-  Uint8 r = 0, g = 0, b = 0, a = 0;
-  if (!SDL_GetRenderDrawColor(renderer, &r, &g, &b, &a)) {
-    SDL_Log("Error while getting renderer draw color: %s", SDL_GetError());
+  // the samples are in samples[0, n), whether the ring buffer is full or not
+  const arena_mark mark = get_arena_mark();
+  float* sorted = arena_alloc(n * sizeof(float));
+  if (sorted == NULL) {
+    return false;
   }
+  SDL_memcpy(sorted, s->samples, n * sizeof(float));
+  SDL_qsort(sorted, n, sizeof(float), compare_floats);
 
-  for (int pass = 0; pass < 2; pass++) {
-    const char* ptr = str;
-    int ix = x;
-    int iy = y;
-    Uint8 icolors = colors;
+  double sum = 0;
+  for (int i = 0; i < n; i++) {
+    sum += sorted[i];
+  }
+  stats->last = s->samples[(s->next > 0 ? s->next : hud->capacity) - 1];
+  stats->min = sorted[0];
+  stats->avg = (float) (sum / n);
+  stats->max = sorted[n - 1];
+  stats->p50 = get_percentile(sorted, n, 50);
+  stats->p95 = get_percentile(sorted, n, 95);
+  stats->p99 = get_percentile(sorted, n, 99);
+  release_arena(mark);
+  return true;
+}
 
-    Uint32 cp = 0;
-    while ((cp = SDL_StepUTF8(&ptr, NULL)) != 0) {
-      if (cp >= 256 && cp == SDL_INVALID_UNICODE_CODEPOINT) {
-        continue;
-      }
+#define BLOCK_ELEMENT_BASE 0x2580 // U+2581 to U+2588: 1/8 to 8/8 blocks
 
-      if (cp == DBGP_ESCAPE_CHAR && DBGP_ENABLE_ESCAPING) {
-        const char* ptr_start_seq = ptr;
-        Uint32 cp1 = SDL_StepUTF8(&ptr, NULL);
-        Uint32 cp2 = SDL_StepUTF8(&ptr, NULL);
+// Whether a font (or its fallbacks) can draw the eight block elements.
+static bool has_block_elements(DBGP_Font* font) {
+  for (Uint32 cp = BLOCK_ELEMENT_BASE + 1; cp <= BLOCK_ELEMENT_BASE + 8;
+       cp++) {
+    Uint32 glyph = 0;
+    const DBGP_Font* owner = resolve_glyph(font, cp, &glyph);
+    if (owner == NULL || owner->atlas.nb_pages == 0) {
+      return false;
+    }
+  }
+  return true;
+}
 
-        if (is_hex(cp1) && is_hex(cp2)) {
-          Uint8 bg = get_hex_value(cp1);
-          Uint8 fg = get_hex_value(cp2);
-          icolors = (bg & 0xf) << 4 | (fg & 0xf);
-          continue;
-        } else {
-          ptr = ptr_start_seq;
+// Queues a line of text, without escape codes nor newlines.
+static void draw_perf_text(
+    DBGP_Font* font, int x, int y, Uint8 colors, const char* str) {
+  int prev_width = 0;
+  Uint32 cp = 0;
+  while ((cp = SDL_StepUTF8(&str, NULL)) != 0) {
+    x += draw_color_text_glyph(NULL, font, x, y, &prev_width, cp, colors);
+  }
+}
+
+// Returns the number of columns of a line of text.
+static int get_perf_text_columns(const DBGP_Font* font, const char* str) {
+  int w = 0;
+  DBGP_MeasureText(font, str, &w, NULL);
+  return w / font->glyph_width;
+}
+
+// Queues the graph of a series: one column per glyph, showing the largest
+// sample of its group of samples, the most recent on the right.
+static void draw_perf_graph(
+    const DBGP_PerfHUD* hud, const DBGP_PerfSeries* series,
+    DBGP_Font* font, int x, int y, float scale, bool use_glyphs) {
+  const int n = series->nb_samples;
+  const int nb_columns = SDL_min(n, hud->graph_width);
+  const int first_column = hud->graph_width - nb_columns;
+  const float height = (float) hud->graph_height * font->glyph_height;
+  if (!use_glyphs && series->colors >> 4 != 0) {
+    draw_rect(
+        x, y, hud->graph_width * font->glyph_width, height,
+        get_palette_color(series->colors >> 4));
+  }
+
+  for (int c = 0; c < hud->graph_width; c++) {
+    float value = 0;
+    if (c >= first_column) {
+      const int first = (c - first_column) * n / nb_columns;
+      const int last = (c - first_column + 1) * n / nb_columns;
+      for (int i = first; i < last; i++) {
+        int index = series->next - n + i;
+        index += index < 0 ? hud->capacity : 0;
+        if (i == first || series->samples[index] > value) {
+          value = series->samples[index];
         }
       }
+    }
+    const float ratio = scale > 0 ? SDL_clamp(value / scale, 0, 1) : 0;
+    const int cx = x + c * font->glyph_width;
 
-      if (cp == '\n') {
-        iy += font->glyph_height;
-        ix = x;
-      } else {
-        SDL_FRect r = {ix, iy, font->glyph_width, font->glyph_height};
-
-        if (pass == 0) {
-          // background
-          Uint32 bg_color = color_palette[icolors >> 4];
-          if (bg_color != 0) {
-            SDL_SetRenderDrawColor(
-                renderer, (bg_color >> 16) & 0xff, (bg_color >> 8) & 0xff,
-                bg_color & 0xff, 0xff);
-            SDL_RenderFillRect(renderer, &r);
-          }
-        } else {
-          // foreground
-          SDL_FRect src = {
-              cp % GLYPHS_PER_LINE * font->glyph_width,
-              cp / GLYPHS_PER_LINE * font->glyph_height, font->glyph_width,
-              font->glyph_height};
-          Uint32 fg_color = color_palette[icolors & 0xf];
-          // SDL_SetRenderDrawColor(renderer, 0xff, 0xff, 0xff, 0xff);
-          SDL_SetTextureColorMod(
-              font->tex, (fg_color >> 16) & 0xff, (fg_color >> 8) & 0xff,
-              fg_color & 0xff);
-          SDL_RenderTexture(renderer, font->tex, &src, &r);
-        }
+    if (!use_glyphs) {
+      if (ratio > 0) {
+        draw_rect(
+            cx, y + height * (1 - ratio), font->glyph_width, height * ratio,
+            get_palette_color(series->colors & 0xf));
+      }
+      continue;
+    }
+    const int eighths = (int) (ratio * hud->graph_height * 8 + 0.5f);
+    for (int row = 0; row < hud->graph_height; row++) {
+      const int level =
+          SDL_clamp(eighths - (hud->graph_height - 1 - row) * 8, 0, 8);
+      if (level > 0 || series->colors >> 4 != 0) {
+        draw_color_glyph(
+            font, cx, y + row * font->glyph_height,
+            level > 0 ? BLOCK_ELEMENT_BASE + level : ' ', series->colors);
+      }
+    }
+  }
+}
+
+bool DBGP_RenderPerfHUD(
+    DBGP_PerfHUD* hud, DBGP_Font* font, SDL_Renderer* renderer, int x, int y,
+    int flags) {
+  if (hud == NULL || font == NULL || font->tex == NULL || renderer == NULL) {
+    return false;
+  }
+  if (!check_not_recording(renderer)) {
+    return false;
+  }
+  const bool use_glyphs =
+      !(flags & DBGP_PERF_GRAPH_RECTS) && has_block_elements(font);
+  int name_width = 0;
+  for (int i = 0; i < hud->nb_series; i++) {
+    name_width =
+        SDL_max(name_width, get_perf_text_columns(font, hud->series[i].name));
+  }
 
-        ix += font->glyph_width;
+  // the lines are formatted first, to size the batch for the whole HUD: up to
+  // a background and two glyphs per codepoint, and a background and a glyph
+  // per cell of the graph (or a rectangle per column, and its background)
+  char lines[DBGP_PERF_MAX_SERIES][DBGP_PERF_NAME_SIZE + 128];
+  int max_quads = 1;
+  for (int i = 0; i < hud->nb_series; i++) {
+    DBGP_PerfSeries* series = &hud->series[i];
+    if (series->stats_outdated) {
+      if (!DBGP_GetPerfStats(hud, i, &series->stats)) {
+        return false;
       }
+      series->stats_outdated = false;
     }
+    const DBGP_PerfStats* stats = &series->stats;
+
+    // names are padded to the same number of columns, not bytes
+    const int padding =
+        name_width - get_perf_text_columns(font, series->name);
+    SDL_snprintf(
+        lines[i], sizeof(lines[i]),
+        "%s%*s %7.2f  min %7.2f avg %7.2f max %7.2f"
+        "  p50 %7.2f p95 %7.2f p99 %7.2f",
+        series->name, padding, "", stats->last, stats->min, stats->avg,
+        stats->max, stats->p50, stats->p95, stats->p99);
+    max_quads += 3 * (int) SDL_utf8strlen(lines[i]) +
+                 hud->graph_width * (hud->graph_height + 1) + 1;
   }
 
-  SDL_SetRenderDrawColor(renderer, r, g, b, a);
+  if (!begin_sized_batch(
+          renderer, max_quads,
+          SDL_min(
+              get_style_atlas(font, font->style)->nb_pages +
+                  font->nb_fallbacks,
+              BATCH_MAX_TEXTURES))) {
+    return false;
+  }
+  int iy = y;
+  for (int i = 0; i < hud->nb_series; i++) {
+    const DBGP_PerfSeries* series = &hud->series[i];
+    draw_perf_text(font, x, iy, series->colors, lines[i]);
+    iy += font->glyph_height;
+
+    const float scale = series->scale > 0 ? series->scale : series->stats.max;
+    draw_perf_graph(hud, series, font, x, iy, scale, use_glyphs);
+    iy += hud->graph_height * font->glyph_height;
+  }
+  end_batch();
 
   return true;
 }
 
-bool DBGP_ColorPrintf(
-    DBGP_Font* font, SDL_Renderer* renderer, int x, int y, Uint8 colors,
-    const char* fmt, ...) {
+// DBGP_Overlay.shared holds the index of the buffer between the threads,
+// and OVERLAY_FRESH while it holds a snapshot the render thread hasn't read.
+// Only the producer sets the flag, so each thread exchanges the index with a
+// single atomic operation.
+#define OVERLAY_FRESH 0x4
+
+bool DBGP_CreateOverlay(DBGP_Overlay* overlay, size_t capacity) {
+  if (overlay == NULL || capacity == 0) {
+    return false;
+  }
+  SDL_memset(overlay, 0, sizeof(*overlay));
+  overlay->buffers = mem_calloc(3, capacity);
+  if (overlay->buffers == NULL) {
+    return false;
+  }
+  overlay->capacity = capacity;
+  overlay->back = 0;
+  overlay->front = 1;
+  SDL_SetAtomicInt(&overlay->shared, 2);
+  return true;
+}
+
+void DBGP_DestroyOverlay(DBGP_Overlay* overlay) {
+  if (overlay == NULL) {
+    return;
+  }
+  mem_free(overlay->buffers);
+  SDL_memset(overlay, 0, sizeof(*overlay));
+}
+
+static inline char* get_overlay_buffer(const DBGP_Overlay* overlay, int i) {
+  return overlay->buffers + i * overlay->capacity;
+}
+
+// Exchanges the back buffer holding a new snapshot with the shared buffer.
+static void publish_overlay(DBGP_Overlay* overlay) {
+  // SDL_SetAtomicInt may only be an acquire barrier: the snapshot must be
+  // visible before its index is
+  SDL_MemoryBarrierRelease();
+  const int shared =
+      SDL_SetAtomicInt(&overlay->shared, overlay->back | OVERLAY_FRESH);
+  overlay->back = shared & ~OVERLAY_FRESH;
+}
+
+void DBGP_OverlayPrint(DBGP_Overlay* overlay, const char* str) {
+  if (overlay == NULL || overlay->buffers == NULL || str == NULL) {
+    return;
+  }
+  SDL_utf8strlcpy(
+      get_overlay_buffer(overlay, overlay->back), str, overlay->capacity);
+  publish_overlay(overlay);
+}
+
+void DBGP_OverlayPrintf(DBGP_Overlay* overlay, const char* fmt, ...) {
+  if (overlay == NULL || overlay->buffers == NULL || fmt == NULL) {
+    return;
+  }
+  // formatted on the stack, as the frame arena belongs to the render thread,
+  // then truncated like DBGP_OverlayPrint, without cutting a UTF-8 sequence
+  char str[DBGP_MAX_STR_LEN];
   va_list args;
   va_start(args, fmt);
-  SDL_vsnprintf(printf_buffer, DBGP_MAX_STR_LEN, fmt, args);
+  SDL_vsnprintf(str, sizeof(str), fmt, args);
   va_end(args);
+  DBGP_OverlayPrint(overlay, str);
+}
+
+const char* DBGP_GetOverlayText(DBGP_Overlay* overlay) {
+  if (overlay == NULL || overlay->buffers == NULL) {
+    return NULL;
+  }
+  if (SDL_GetAtomicInt(&overlay->shared) & OVERLAY_FRESH) {
+    const int shared = SDL_SetAtomicInt(&overlay->shared, overlay->front);
+    overlay->front = shared & ~OVERLAY_FRESH;
+    SDL_MemoryBarrierAcquire();
+  }
+  return get_overlay_buffer(overlay, overlay->front);
+}
 
-  return DBGP_ColorPrint(font, renderer, x, y, colors, printf_buffer);
+bool DBGP_RenderOverlay(
+    DBGP_Overlay* overlay, DBGP_Font* font, SDL_Renderer* renderer, int x,
+    int y, Uint8 colors) {
+  const char* str = DBGP_GetOverlayText(overlay);
+  return str != NULL && DBGP_ColorPrint(font, renderer, x, y, colors, str);
 }
 
+#undef OVERLAY_FRESH
+#undef PAIR_WIDE
+#undef WIDTH_NB_BLOCKS
+#undef BLOCK_ELEMENT_BASE
+#undef ALL_STYLES
+#undef COMMAND_ALIGN
+#undef ARENA_ALIGN
+#undef ARENA_HEADER_SIZE
 #undef GLYPH_WIDTH
-#undef GLYPHS_PER_LINE
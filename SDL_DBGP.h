@@ -16,12 +16,36 @@
  * UNSCII `.hex` files is also available (unscii2raw.py). Checkout the file
  * "example.c" for a full example, or jump right in:
  *
+ * \sa DBGP_SetAllocator
  * \sa DBGP_CreateFont
+ * \sa DBGP_PrepareFontAsync
+ * \sa DBGP_CreateFontFromHex
+ * \sa DBGP_CreateFontFromPSF
+ * \sa DBGP_CreateFontFromBDF
  * \sa DBGP_DestroyFont
+ * \sa DBGP_SetFontFallbacks
+ * \sa DBGP_CreateFontStyles
+ * \sa DBGP_CreateFontGroup
+ * \sa DBGP_GetFontMemoryUsage
  * \sa DBGP_Print
  * \sa DBGP_Printf
  * \sa DBGP_ColorPrint
  * \sa DBGP_ColorPrintf
+ * \sa DBGP_PrintWrapped
+ * \sa DBGP_MeasureText
+ * \sa DBGP_RenderCells
+ * \sa DBGP_RenderCompiled
+ * \sa DBGP_BeginBatch
+ * \sa DBGP_UpdateTextLayout
+ * \sa DBGP_CreateTextView
+ * \sa DBGP_PrintToSurface
+ * \sa DBGP_ColorPrintToSurface
+ * \sa DBGP_WriteANSI
+ * \sa DBGP_BeginOverlayCache
+ * \sa DBGP_RenderPerfHUD
+ * \sa DBGP_StartTrace
+ * \sa DBGP_BuildGeometry
+ * \sa DBGP_CreateOverlay
  *
  */
 
@@ -31,7 +55,12 @@
 #include <stdbool.h>
 #include <SDL3/SDL.h>
 
-/** The size of the internal text formatting buffer used by DBGP_Printf */
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/** The maximum size (NULL character included) of the strings formatted by
+ * DBGP_Printf and DBGP_ColorPrintf; longer strings are truncated */
 #ifndef DBGP_MAX_STR_LEN
 #define DBGP_MAX_STR_LEN 4096
 #endif
@@ -49,10 +78,213 @@
 #define DBGP_ESCAPE_CHAR '$'
 #endif
 
+/** For "DBGP_Color*" functions only. The number of glyphs between two tab
+ * stops (tabs are only expanded when DBGP_ENABLE_ESCAPING is set) */
+#ifndef DBGP_TAB_WIDTH
+#define DBGP_TAB_WIDTH 8
+#endif
+
 /** For "DBGP_Color*" functions only. The default color to draw in (white on
  * transparent background) */
 #define DBGP_DEFAULT_COLORS 0x0f
 
+/** For DBGP_PrintWrapped and text layouts. Lines are broken between words */
+#define DBGP_WRAP_WORD 0x00
+/** For DBGP_PrintWrapped and text layouts. Lines are broken between glyphs */
+#define DBGP_WRAP_CHAR 0x01
+/** For DBGP_PrintWrapped and text layouts. Lines are aligned on the left */
+#define DBGP_ALIGN_LEFT 0x00
+/** For DBGP_PrintWrapped and text layouts. Lines are centered */
+#define DBGP_ALIGN_CENTER 0x10
+/** For DBGP_PrintWrapped and text layouts. Lines are aligned on the right */
+#define DBGP_ALIGN_RIGHT 0x20
+
+/** For DBGP_SetFontStyle. Glyphs are drawn as is */
+#define DBGP_STYLE_PLAIN 0x00
+/** For DBGP_CreateFontStyles and DBGP_SetFontStyle. Glyphs have a black drop
+ * shadow, 1px below and right */
+#define DBGP_STYLE_SHADOW 0x01
+/** For DBGP_CreateFontStyles and DBGP_SetFontStyle. Glyphs have a black 1px
+ * outline */
+#define DBGP_STYLE_OUTLINE 0x02
+/** For DBGP_CreateFontStyles and DBGP_SetFontStyle. Glyphs are thickened by
+ * 1px on the right (faux bold) */
+#define DBGP_STYLE_BOLD 0x04
+/** The number of styles besides DBGP_STYLE_PLAIN */
+#define DBGP_NB_STYLES 3
+
+/** For DBGP_RenderCells. Packs a glyph index (0-255) and colors into a
+ * 16-bit cell, like VGA text memory */
+#define DBGP_CELL(glyph, colors) ((Uint16) ((colors) << 8 | ((glyph) & 0xff)))
+/** For DBGP_RenderCells32. Packs a glyph index (0-0xffffff) and colors into a
+ * 32-bit cell */
+#define DBGP_CELL32(glyph, colors)                                            \
+  ((Uint32) (colors) << 24 | ((Uint32) (glyph) & 0xffffff))
+
+/** The version of the traces written by DBGP_StartTrace. Traces are a "DBGT"
+ * magic and this version byte, followed by records made of a DBGP_TRACE_*
+ * type byte and LEB128 varints (zigzag-encoded when signed). Strings are
+ * their length followed by their bytes */
+#define DBGP_TRACE_VERSION 1
+/** Trace record: font id, glyph height, number of glyphs (before the first
+ * record using the font) */
+#define DBGP_TRACE_FONT 1
+/** Trace record: font id, x, y, background and foreground RGBA bytes,
+ * string */
+#define DBGP_TRACE_PRINT 2
+/** Trace record: font id, x, y, colors byte, string */
+#define DBGP_TRACE_COLOR_PRINT 3
+/** Trace record: font id, box x, y, w, h, colors byte, flags, string */
+#define DBGP_TRACE_PRINT_WRAPPED 4
+/** Trace record: end of a frame */
+#define DBGP_TRACE_FRAME 5
+
+/** The maximum number of textures a font atlas can be split into, for fonts
+ * that don't fit in a single texture */
+#ifndef DBGP_MAX_ATLAS_PAGES
+#define DBGP_MAX_ATLAS_PAGES 8
+#endif
+
+/** The number of entries of the codepoint resolution cache of fonts having
+ * fallbacks (must be a power of two) */
+#ifndef DBGP_FALLBACK_CACHE_SIZE
+#define DBGP_FALLBACK_CACHE_SIZE 256
+#endif
+
+/** The size in bytes of the chunks of the frame arena, the scratch memory
+ * used while drawing (see DBGP_ResetFrameArena) */
+#ifndef DBGP_FRAME_ARENA_SIZE
+#define DBGP_FRAME_ARENA_SIZE (128 * 1024)
+#endif
+
+/** The maximum number of numeric parameters kept for one ANSI control
+ * sequence (extra parameters are ignored) */
+#ifndef DBGP_ANSI_MAX_PARAMS
+#define DBGP_ANSI_MAX_PARAMS 16
+#endif
+
+/** The size in bytes of the buffer of traces (see DBGP_StartTrace) */
+#ifndef DBGP_TRACE_BUFFER_SIZE
+#define DBGP_TRACE_BUFFER_SIZE 4096
+#endif
+
+/** The maximum number of series of a performance HUD */
+#ifndef DBGP_PERF_MAX_SERIES
+#define DBGP_PERF_MAX_SERIES 8
+#endif
+
+/** The maximum size (NULL character included) of the names of performance
+ * HUD series; longer names are truncated */
+#ifndef DBGP_PERF_NAME_SIZE
+#define DBGP_PERF_NAME_SIZE 16
+#endif
+
+/** Whether DBGP_TextView scans text with memchr from the C library (usually
+ * vectorized) rather than a byte loop; SDL has no SDL_memchr, set it to 0 to
+ * build without the C library */
+#ifndef DBGP_USE_LIBC_MEMCHR
+#define DBGP_USE_LIBC_MEMCHR 1
+#endif
+
+/** The maximum size (NULL character included) of the filter of a text view */
+#ifndef DBGP_TEXT_VIEW_FILTER_SIZE
+#define DBGP_TEXT_VIEW_FILTER_SIZE 256
+#endif
+
+/** For DBGP_RenderPerfHUD. Graphs are drawn with the block elements U+2581 to
+ * U+2588 of the font (or its fallbacks) when it has them */
+#define DBGP_PERF_GRAPH_AUTO 0x00
+/** For DBGP_RenderPerfHUD. Graphs are always drawn with filled rectangles */
+#define DBGP_PERF_GRAPH_RECTS 0x01
+
+/** A function allocating memory, like malloc (see DBGP_SetAllocator) */
+typedef void*(SDLCALL* DBGP_MallocFunc)(void* userdata, size_t size);
+/** A function resizing memory, like realloc (see DBGP_SetAllocator) */
+typedef void*(SDLCALL* DBGP_ReallocFunc)(
+    void* userdata, void* mem, size_t size);
+/** A function freeing memory, like free (see DBGP_SetAllocator) */
+typedef void(SDLCALL* DBGP_FreeFunc)(void* userdata, void* mem);
+
+/**
+ * \fn bool DBGP_SetAllocator(DBGP_MallocFunc malloc_fn,
+ * DBGP_ReallocFunc realloc_fn, DBGP_FreeFunc free_fn, void* userdata)
+ * \brief Sets the functions used by DBGP to allocate memory.
+ *
+ * By default, DBGP uses SDL_malloc, SDL_realloc and SDL_free. Memory
+ * allocated by SDL itself (surfaces, textures, threads...) isn't affected:
+ * see SDL_SetMemoryFunctions. The functions must be thread-safe if fonts are
+ * prepared with DBGP_PrepareFontAsync.
+ *
+ * This must be called before creating any DBGP object (fonts, layouts...),
+ * since their memory is freed with the current functions. The frame arena is
+ * freed with the previous functions, which is why this fails while a batch
+ * is open (see DBGP_BeginBatch).
+ *
+ * \param malloc_fn The function allocating memory
+ * \param realloc_fn The function resizing memory
+ * \param free_fn The function freeing memory
+ * \param userdata A pointer passed to the functions
+ * \return true on success or false on failure (if only some functions are
+ * NULL, or a batch is open); call SDL_GetError() for more information.
+ * Passing NULL for all the functions restores the default ones.
+ *
+ * \sa DBGP_ResetFrameArena
+ */
+bool DBGP_SetAllocator(
+    DBGP_MallocFunc malloc_fn, DBGP_ReallocFunc realloc_fn,
+    DBGP_FreeFunc free_fn, void* userdata);
+
+/**
+ * \fn void DBGP_ResetFrameArena(void)
+ * \brief Resets the frame arena, the scratch memory used while drawing.
+ *
+ * Transient storage (vertices being batched, strings formatted by
+ * DBGP_Printf...) is allocated from a bump arena and released at the end of
+ * each call. The arena grows by chunks of DBGP_FRAME_ARENA_SIZE bytes (or
+ * more) when a call needs more memory. Calling this function once per frame
+ * (e.g. after SDL_RenderPresent) merges the chunks allocated during the frame
+ * into one, so that no memory is allocated in the following frames.
+ *
+ * Nothing is done while a batch is open (see DBGP_BeginBatch), as its
+ * vertices are in the arena.
+ *
+ * \sa DBGP_SetAllocator
+ */
+void DBGP_ResetFrameArena(void);
+
+/**
+ * \struct DBGP_FontAtlas
+ * \brief Describes the textures holding the glyphs of a font.
+ *
+ * Glyphs are laid out on a grid, from left to right and top to bottom. When a
+ * font doesn't fit in the maximum texture size of the renderer, glyphs are
+ * split into several pages (textures) of the same size.
+ *
+ * This struct should be considered read-only.
+ */
+struct DBGP_FontAtlas {
+  int glyphs_per_line; /**< the number of glyphs on each line of a page */
+  int glyphs_per_page; /**< the number of glyphs on each page */
+  int nb_pages; /**< the number of pages (textures) */
+  int width; /**< the width in pixels of each page */
+  int height; /**< the height in pixels of each page */
+  int cell_width; /**< the width in pixels of the cell of each glyph */
+  int cell_height; /**< the height in pixels of the cell of each glyph */
+  int glyph_x; /**< the X position of the glyph in its cell (where a style
+                  effect extends left of the glyph) */
+  int glyph_y; /**< the Y position of the glyph in its cell */
+  int x; /**< the X position of the glyph grid in the pages (not 0 when the
+            atlas is shared by a font group) */
+  int y; /**< the Y position of the glyph grid in the pages */
+  bool shared; /**< whether the pages belong to a font group */
+  SDL_PixelFormat format; /**< the pixel format of the textures */
+  SDL_Texture* pages[DBGP_MAX_ATLAS_PAGES]; /**< the textures */
+  SDL_Surface* surfaces[DBGP_MAX_ATLAS_PAGES]; /**< the prepared pages, until
+                                                  they are uploaded (see
+                                                  DBGP_PrepareFont) */
+};
+typedef struct DBGP_FontAtlas DBGP_FontAtlas; /**< Convenience typedef */
+
 /**
  * \struct DBGP_Font
  * \brief Represents a font that will be used to display glyphes on screen.
@@ -65,7 +297,33 @@ struct DBGP_Font {
   Uint8 glyph_width; /**< the width in pixels of each glyph. Always 8. */
   Uint8 glyph_height; /**< the height in pixels of each glyph */
   unsigned int nb_glyphs; /**< the number of glyphs in font */
-  SDL_Texture* tex; /**< texture used when drawing text */
+  SDL_Texture* tex; /**< texture used when drawing text (first atlas page) */
+  DBGP_FontAtlas atlas; /**< textures used when drawing text */
+  DBGP_FontAtlas style_atlases[DBGP_NB_STYLES]; /**< textures used when
+                                                   drawing text with a style
+                                                   (see
+                                                   DBGP_CreateFontStyles) */
+  int style; /**< the style text is drawn with (see DBGP_SetFontStyle) */
+  unsigned char* raw_data; /**< copy of the glyph bitmaps (glyph_height bytes
+                              per glyph, most significant bit on the left),
+                              used when drawing into surfaces */
+  Uint32* codepoints; /**< sorted codepoints having a glyph, or NULL when glyph
+                         N is the glyph of codepoint N */
+  Uint32* codepoint_glyphs; /**< the glyph index of each codepoint in
+                               codepoints */
+  unsigned int nb_codepoints; /**< the number of entries in codepoints */
+  Uint8* wide_glyphs; /**< bitset of the glyphs of wide codepoints whose
+                         right half is the next glyph (glyphs 16px wide,
+                         split in two), or NULL if there is none */
+  struct DBGP_Font** fallbacks; /**< fonts used for the codepoints missing
+                                   from this font, in order */
+  int nb_fallbacks; /**< the number of fonts in fallbacks */
+  Uint64* fallback_cache; /**< direct-mapped cache of the font (and glyph)
+                             each codepoint resolves to */
+  SDL_Thread* prepare_thread; /**< the thread preparing the font (see
+                                 DBGP_PrepareFontAsync) */
+  SDL_AtomicInt prepare_state; /**< the state of the asynchronous
+                                  preparation */
 };
 typedef struct DBGP_Font DBGP_Font; /**< Convenience typedef */
 
@@ -78,26 +336,215 @@ typedef struct DBGP_Font DBGP_Font; /**< Convenience typedef */
  * (8x16px). To use the 8x16px one, use:
  *
  * \code
+ * #define DBGP_UNSCII16_IMPLEMENTATION // in exactly one source file
+ * #include "SDL_DBGP_unscii16.h"
+ *
  * DBGP_Font font;
  * DBGP_CreateFont(&font, renderer, DBGP_UNSCII16, sizeof(DBGP_UNSCII16),
  *   DBGP_UNSCII16_HEIGHT)
  * \endcode
  *
+ * The glyphs are packed in the smallest texture format with an alpha channel
+ * supported by the renderer. The atlas dimensions are chosen to minimize
+ * padding while respecting the renderer maximum texture size; fonts that
+ * don't fit in a single texture are split into up to DBGP_MAX_ATLAS_PAGES
+ * textures.
+ *
+ * renderer may be NULL, in which case no texture is created and the font can
+ * only be used with DBGP_PrintToSurface and DBGP_ColorPrintToSurface.
+ *
+ * This is the same as DBGP_PrepareFont followed by DBGP_UploadFont.
+ *
+ * raw_data may also be compressed font data, as generated by unscii2raw.py
+ * (the bundled fonts are compressed); it is recognized by its header and
+ * decompressed in a single pass. Its glyph height must match glyph_height.
+ *
  * \param font The font to draw with
- * \param renderer The rendering context
- * \param raw_data A pointer to the font raw data
+ * \param renderer The rendering context (may be NULL)
+ * \param raw_data A pointer to the font raw (or compressed) data
  * \param raw_data_len The size in bytes of raw_data
  * \param glyph_height the height in pixels of one glyph (character)
  * \return true on success or false on failure; call SDL_GetError() for more
  * information.
  *
  * \sa DBGP_DestroyFont
+ * \sa DBGP_PrepareFontAsync
  */
 bool DBGP_CreateFont(
     DBGP_Font* font, SDL_Renderer* renderer,
     const unsigned char* const raw_data, size_t raw_data_len,
     Uint8 glyph_height);
 
+/**
+ * \fn bool DBGP_PrepareFont(DBGP_Font* font, SDL_Renderer* renderer,
+ * const unsigned char* const raw_data, size_t raw_data_len, Uint8 glyph_height)
+ * \brief Does the CPU work of DBGP_CreateFont: decompresses the glyphs, lays
+ * out the atlas and draws its pages into surfaces.
+ *
+ * The renderer is only queried for its supported texture formats and
+ * maximum texture size, which SDL only allows on the thread owning it. With a
+ * NULL renderer, this function may be called from any thread, and the atlas
+ * is laid out by DBGP_UploadFont; DBGP_PrepareFontAsync queries the renderer
+ * before starting its thread. Several fonts may be prepared in parallel. The
+ * font must then be finished with DBGP_UploadFont, on the thread owning the
+ * renderer.
+ *
+ * \param font The font to prepare
+ * \param renderer The rendering context the font will be uploaded to (may
+ * be NULL)
+ * \param raw_data A pointer to the font raw (or compressed) data
+ * \param raw_data_len The size in bytes of raw_data
+ * \param glyph_height the height in pixels of one glyph (character)
+ * \return true on success or false on failure; call SDL_GetError() for more
+ * information.
+ *
+ * \sa DBGP_PrepareFontAsync
+ * \sa DBGP_UploadFont
+ */
+bool DBGP_PrepareFont(
+    DBGP_Font* font, SDL_Renderer* renderer,
+    const unsigned char* const raw_data, size_t raw_data_len,
+    Uint8 glyph_height);
+
+/**
+ * \fn bool DBGP_PrepareFontAsync(DBGP_Font* font, SDL_Renderer* renderer,
+ * const unsigned char* const raw_data, size_t raw_data_len, Uint8 glyph_height)
+ * \brief Runs DBGP_PrepareFont on a new thread.
+ *
+ * The renderer is queried on the calling thread, which must own it (unless
+ * it's NULL). raw_data must stay valid until the preparation is complete. Use
+ * DBGP_IsFontPrepared to know when DBGP_UploadFont can be called without
+ * waiting (it waits for the preparation otherwise). The font must not be
+ * used in the meantime, except by DBGP_DestroyFont (which also waits).
+ *
+ * \param font The font to prepare
+ * \param renderer The rendering context the font will be uploaded to (may
+ * be NULL)
+ * \param raw_data A pointer to the font raw (or compressed) data
+ * \param raw_data_len The size in bytes of raw_data
+ * \param glyph_height the height in pixels of one glyph (character)
+ * \return true if the thread was started or false on failure; call
+ * SDL_GetError() for more information.
+ *
+ * \sa DBGP_IsFontPrepared
+ * \sa DBGP_UploadFont
+ */
+bool DBGP_PrepareFontAsync(
+    DBGP_Font* font, SDL_Renderer* renderer,
+    const unsigned char* const raw_data, size_t raw_data_len,
+    Uint8 glyph_height);
+
+/**
+ * \fn bool DBGP_IsFontPrepared(DBGP_Font* font)
+ * \brief Returns whether the preparation of a font is complete (whether it
+ * succeeded or not), without blocking.
+ *
+ * \param font The font being prepared
+ * \return true if DBGP_UploadFont can be called without waiting.
+ *
+ * \sa DBGP_PrepareFontAsync
+ */
+bool DBGP_IsFontPrepared(DBGP_Font* font);
+
+/**
+ * \fn bool DBGP_UploadFont(DBGP_Font* font, SDL_Renderer* renderer)
+ * \brief Creates the textures of a prepared font.
+ *
+ * Must be called on the thread owning the renderer. Waits for the
+ * preparation started by DBGP_PrepareFontAsync if it isn't complete. If the
+ * preparation failed, the font is destroyed (the reason is logged by the
+ * preparation thread). When renderer is NULL, the font can only be used with
+ * DBGP_PrintToSurface and DBGP_ColorPrintToSurface.
+ *
+ * \param font The prepared font
+ * \param renderer The rendering context (may be NULL)
+ * \return true on success or false on failure; call SDL_GetError() for more
+ * information.
+ *
+ * \sa DBGP_PrepareFont
+ * \sa DBGP_PrepareFontAsync
+ */
+bool DBGP_UploadFont(DBGP_Font* font, SDL_Renderer* renderer);
+
+/**
+ * \fn bool DBGP_CreateFontFromHex(DBGP_Font* font, SDL_Renderer* renderer,
+ * SDL_IOStream* src, bool closeio, Uint8 glyph_height)
+ * \brief Creates a font object from a `.hex` file (as used by GNU Unifont and
+ * UNSCII).
+ *
+ * Each line of the file is a codepoint and the bitmap of its glyph, both in
+ * hexadecimal (`0041:0000000018242442427E424242420000`). Any codepoint can be
+ * included. Glyphs 16px wide are split into two glyphs (see
+ * DBGP_Font.wide_glyphs), drawn side by side for wide codepoints (see
+ * DBGP_GetCodepointWidth) and only their left half otherwise; glyphs of other
+ * sizes are skipped. The file is parsed in a single pass.
+ *
+ * \param font The font to create
+ * \param renderer The rendering context (may be NULL, see DBGP_CreateFont)
+ * \param src The stream to read the file from
+ * \param closeio If true, calls SDL_CloseIO() on src before returning, even in
+ * the case of an error
+ * \param glyph_height the height in pixels of one glyph (character)
+ * \return true on success or false on failure; call SDL_GetError() for more
+ * information.
+ *
+ * \sa DBGP_CreateFont
+ * \sa DBGP_DestroyFont
+ */
+bool DBGP_CreateFontFromHex(
+    DBGP_Font* font, SDL_Renderer* renderer, SDL_IOStream* src, bool closeio,
+    Uint8 glyph_height);
+
+/**
+ * \fn bool DBGP_CreateFontFromPSF(DBGP_Font* font, SDL_Renderer* renderer,
+ * SDL_IOStream* src, bool closeio)
+ * \brief Creates a font object from a PC Screen Font file (version 1 or 2),
+ * as used by the Linux console.
+ *
+ * Glyphs must be 8px (or less) wide. When the file has a unicode table,
+ * glyphs are mapped to the codepoints listed in it (sequences are ignored);
+ * otherwise glyph N is used for codepoint N. The file is parsed in a single
+ * pass; compressed (`.psf.gz`) files are not supported.
+ *
+ * \param font The font to create
+ * \param renderer The rendering context (may be NULL, see DBGP_CreateFont)
+ * \param src The stream to read the file from
+ * \param closeio If true, calls SDL_CloseIO() on src before returning, even in
+ * the case of an error
+ * \return true on success or false on failure; call SDL_GetError() for more
+ * information.
+ *
+ * \sa DBGP_CreateFont
+ * \sa DBGP_DestroyFont
+ */
+bool DBGP_CreateFontFromPSF(
+    DBGP_Font* font, SDL_Renderer* renderer, SDL_IOStream* src, bool closeio);
+
+/**
+ * \fn bool DBGP_CreateFontFromBDF(DBGP_Font* font, SDL_Renderer* renderer,
+ * SDL_IOStream* src, bool closeio)
+ * \brief Creates a font object from a Glyph Bitmap Distribution Format
+ * (`.bdf`) file.
+ *
+ * The font bounding box must be 8px (or less) wide; its height is used as the
+ * glyph height. Each glyph is placed in the font bounding box according to its
+ * own bounding box and the font ascent. Glyphs without encoding are skipped.
+ * The file is parsed in a single pass.
+ *
+ * \param font The font to create
+ * \param renderer The rendering context (may be NULL, see DBGP_CreateFont)
+ * \param src The stream to read the file from
+ * \param closeio If true, calls SDL_CloseIO() on src before returning, even in
+ * the case of an error
+ * \return true on success or false on failure; call SDL_GetError() for more
+ * information.
+ *
+ * \sa DBGP_CreateFont
+ * \sa DBGP_DestroyFont
+ */
+bool DBGP_CreateFontFromBDF(
+    DBGP_Font* font, SDL_Renderer* renderer, SDL_IOStream* src, bool closeio);
+
 /**
  * \fn void DBGP_DestroyFont(DBGP_Font* font)
  * \brief Frees all memory allocated during DBGP_CreateFont.
@@ -106,6 +553,166 @@ bool DBGP_CreateFont(
  */
 void DBGP_DestroyFont(DBGP_Font* font);
 
+/**
+ * \fn bool DBGP_CreateFontStyles(DBGP_Font* font, SDL_Renderer* renderer,
+ * int styles)
+ * \brief Creates the atlases of styled variants of the glyphs of a font.
+ *
+ * The glyph bitmaps are dilated once, into atlases whose glyph pixels are
+ * white and shadow or outline pixels black: text drawn with a style costs
+ * the same as plain text (one quad per glyph), instead of drawing it several
+ * times with offsets. The foreground color tints the glyphs; shadows and
+ * outlines stay black. Styled glyphs extend over their neighbours by 1px
+ * (left, right, top and bottom for outlines, right and bottom for shadows,
+ * right for bold glyphs); backgrounds are unchanged.
+ *
+ * Styles only apply to rendering: DBGP_PrintToSurface draws plain glyphs.
+ * Like the font textures, style atlases are lost on
+ * SDL_EVENT_RENDER_TARGETS_RESET and must be created again with the font.
+ *
+ * \param font The font, already created with a renderer
+ * \param renderer The rendering context
+ * \param styles A combination of DBGP_STYLE_SHADOW, DBGP_STYLE_OUTLINE and
+ * DBGP_STYLE_BOLD (styles already created are kept)
+ * \return true on success or false on failure; call SDL_GetError() for more
+ * information.
+ *
+ * \sa DBGP_SetFontStyle
+ */
+bool DBGP_CreateFontStyles(
+    DBGP_Font* font, SDL_Renderer* renderer, int styles);
+
+/**
+ * \fn bool DBGP_SetFontStyle(DBGP_Font* font, int style)
+ * \brief Sets the style the print functions draw a font with.
+ *
+ * The style applies to all functions drawing with the renderer, until it's
+ * changed. Glyphs drawn from fallback fonts use the same style if their font
+ * has it, and are plain otherwise. Overlay caches record the style of each
+ * call.
+ *
+ * \param font The font
+ * \param style DBGP_STYLE_PLAIN, or one style created with
+ * DBGP_CreateFontStyles
+ * \return true on success or false on failure; call SDL_GetError() for more
+ * information.
+ *
+ * \sa DBGP_CreateFontStyles
+ */
+bool DBGP_SetFontStyle(DBGP_Font* font, int style);
+
+/**
+ * \fn bool DBGP_SetFontFallbacks(DBGP_Font* font, DBGP_Font* const*
+ * fallbacks, int nb_fallbacks)
+ * \brief Sets the fonts used to draw the codepoints a font has no glyph for.
+ *
+ * Each codepoint is drawn with the first font having a glyph for it: font
+ * itself, then fallbacks in order (the fallbacks of fallback fonts are not
+ * used). Codepoints found in no font are skipped, as usual. Resolutions are
+ * memoized in a direct-mapped cache of DBGP_FALLBACK_CACHE_SIZE entries, so
+ * drawing a glyph costs a single lookup in most cases. As every function
+ * laying text out with the font updates its cache (which is why they take a
+ * non-const font), a font with fallbacks must not be used by several threads
+ * at once.
+ *
+ * All fonts must have the same glyph height. Fallback fonts are not copied:
+ * they must outlive font, and this function must be called again after they
+ * are recreated (e.g. after SDL_EVENT_RENDER_TARGETS_RESET). Text using
+ * several fonts is drawn with one batch per texture in use.
+ *
+ * \param font The font to set the fallbacks of
+ * \param fallbacks The fallback fonts, in order (may be NULL if nb_fallbacks
+ * is 0)
+ * \param nb_fallbacks The number of fonts in fallbacks (0 removes the
+ * fallbacks)
+ * \return true on success or false on failure; call SDL_GetError() for more
+ * information.
+ *
+ * \sa DBGP_CreateFont
+ */
+bool DBGP_SetFontFallbacks(
+    DBGP_Font* font, DBGP_Font* const* fallbacks, int nb_fallbacks);
+
+/**
+ * \struct DBGP_FontGroup
+ * \brief A texture shared by the atlases of several fonts.
+ *
+ * This struct should be considered read-only.
+ *
+ * \sa DBGP_CreateFontGroup
+ */
+struct DBGP_FontGroup {
+  SDL_Texture* texture; /**< the texture holding the glyphs of the fonts */
+  int width; /**< the width in pixels of the texture */
+  int height; /**< the height in pixels of the texture */
+  SDL_PixelFormat format; /**< the pixel format of the texture */
+  DBGP_Font** fonts; /**< the grouped fonts */
+  int nb_fonts; /**< the number of grouped fonts */
+};
+typedef struct DBGP_FontGroup DBGP_FontGroup; /**< Convenience typedef */
+
+/**
+ * \fn bool DBGP_CreateFontGroup(DBGP_FontGroup* group,
+ * SDL_Renderer* renderer, DBGP_Font* const* fonts, int nb_fonts)
+ * \brief Packs the atlases of several fonts into a single texture.
+ *
+ * The atlases of the fonts (including the style atlases created so far, see
+ * DBGP_CreateFontStyles) are placed on shelves of one texture, and their own
+ * textures are destroyed. Text drawn with any of the fonts (or their
+ * fallbacks, when they are in the group) then uses a single texture: between
+ * DBGP_BeginBatch and DBGP_EndBatch, it is drawn with one
+ * SDL_RenderGeometry call for the glyphs, and one for the backgrounds.
+ *
+ * Each atlas must fit in a single page, and the fonts must have been created
+ * with the same renderer. A font can only belong to one group. The group
+ * texture is not counted by DBGP_GetFontMemoryUsage.
+ *
+ * Destroying the group removes its texture from the fonts, which can't draw
+ * anymore (drawing functions fail) until they are created again: destroy the
+ * group with its fonts (e.g. on SDL_EVENT_RENDER_TARGETS_RESET, then create
+ * again the fonts and the group). The font structs must stay valid until the
+ * group is destroyed, but the fonts may be destroyed before it.
+ *
+ * \param group The font group to initialise
+ * \param renderer The rendering context
+ * \param fonts The fonts to group, created with renderer
+ * \param nb_fonts The number of fonts
+ * \return true on success or false on failure; call SDL_GetError() for more
+ * information.
+ *
+ * \sa DBGP_DestroyFontGroup
+ * \sa DBGP_BeginBatch
+ */
+bool DBGP_CreateFontGroup(
+    DBGP_FontGroup* group, SDL_Renderer* renderer, DBGP_Font* const* fonts,
+    int nb_fonts);
+
+/**
+ * \fn void DBGP_DestroyFontGroup(DBGP_FontGroup* group)
+ * \brief Destroys the texture of a font group.
+ *
+ * \sa DBGP_CreateFontGroup
+ */
+void DBGP_DestroyFontGroup(DBGP_FontGroup* group);
+
+/**
+ * \fn bool DBGP_GetFontMemoryUsage(const DBGP_Font* font, size_t* gpu_bytes,
+ * size_t* cpu_bytes)
+ * \brief Reports the memory used by a font.
+ *
+ * \param font The font to query
+ * \param gpu_bytes Filled with the size in bytes of the font textures (may be
+ * NULL)
+ * \param cpu_bytes Filled with the size in bytes of the font data kept in
+ * system memory, including the DBGP_Font struct itself (may be NULL)
+ * \return true on success or false on failure; call SDL_GetError() for more
+ * information.
+ *
+ * \sa DBGP_CreateFont
+ */
+bool DBGP_GetFontMemoryUsage(
+    const DBGP_Font* font, size_t* gpu_bytes, size_t* cpu_bytes);
+
 /**
  * \fn bool DBGP_ColorPrint(DBGP_Font* font, SDL_Renderer* renderer, int x,
  * int y, Uint8 colors, const char* str)
@@ -127,6 +734,18 @@ void DBGP_DestroyFont(DBGP_Font* font);
  * where "f" is the background color, and "0" is the foreground color. This
  * feature can be disabled by setting DBGP_ENABLE_ESCAPING to 0.
  *
+ * Other escape codes move the position of the next glyph, so that text at
+ * several places of the screen can be drawn with a single call:
+ *
+ * - `$G<col>,<row>;` moves to a column and row (in glyphs) of the text
+ * - `$P<x>,<y>;` moves to a position (in pixels) from the text origin
+ * - `$M<dx>,<dy>;` moves by an offset in pixels (which may be negative)
+ * - `$*<n>;<c>` draws the glyph c n times, e.g. `$*120;-` draws a rule
+ *
+ * Tabs move to the next tab stop, every DBGP_TAB_WIDTH glyphs from x. An
+ * escape character not starting a valid escape code is drawn as is. As with
+ * DBGP_Print, wide codepoints take two cells and combining marks none.
+ *
  * \param font The font to draw with
  * \param renderer The rendering context
  * \param x The X coordinate of the text
@@ -179,6 +798,9 @@ bool DBGP_ColorPrintf(
  * \brief Draws some text on a renderer. String must be UTF-8 encoded and NULL
  * terminated.
  *
+ * Each codepoint is drawn in as many cells as its width (see
+ * DBGP_GetCodepointWidth), so that text stays aligned on columns.
+ *
  * \param font The font to draw with
  * \param renderer The rendering context
  * \param x The X coordinate of the text
@@ -223,4 +845,1194 @@ bool DBGP_Printf(
     DBGP_Font* font, SDL_Renderer* renderer, int x, int y, SDL_Color bg_color,
     SDL_Color fg_color, const char* fmt, ...);
 
+/**
+ * \fn int DBGP_GetCodepointWidth(Uint32 cp)
+ * \brief Returns the number of cells a codepoint is drawn in.
+ *
+ * Wide and fullwidth codepoints (CJK ideographs, Hangul syllables, emoji...)
+ * take two cells, combining marks and format characters none (they are drawn
+ * at the start of the previous codepoint, and skipped at the start of a line
+ * or after a cursor movement), and all others one, including every codepoint
+ * below U+0300. Wide codepoints are drawn
+ * with both halves of the 16px wide glyphs loaded by DBGP_CreateFontFromHex,
+ * or with an 8px wide glyph on the left of their cells.
+ *
+ * Widths come from a two-stage table generated from the Unicode Character
+ * Database by ucd2width.py: a lookup costs two memory accesses, and none
+ * below U+0300.
+ *
+ * \param cp The codepoint
+ * \return 0, 1 or 2
+ *
+ * \sa DBGP_MeasureText
+ */
+int DBGP_GetCodepointWidth(Uint32 cp);
+
+/**
+ * \fn bool DBGP_MeasureText(const DBGP_Font* font, const char* str, int* w,
+ * int* h)
+ * \brief Computes the size in pixels of some text drawn by DBGP_Print.
+ *
+ * \param font The font the text is drawn with
+ * \param str The text. Must be UTF-8 encoded and NULL terminated.
+ * \param w Filled with the width of the text (may be NULL)
+ * \param h Filled with the height of the text (may be NULL)
+ * \return true on success or false on failure; call SDL_GetError() for more
+ * information.
+ *
+ * \sa DBGP_ColorMeasureText
+ */
+bool DBGP_MeasureText(const DBGP_Font* font, const char* str, int* w, int* h);
+
+/**
+ * \fn bool DBGP_ColorMeasureText(const DBGP_Font* font, const char* str,
+ * int* w, int* h)
+ * \brief Computes the size in pixels of some text drawn by DBGP_ColorPrint.
+ *
+ * Escape codes are applied: the size covers every glyph right and below the
+ * text origin.
+ *
+ * \param font The font the text is drawn with
+ * \param str The text. Must be UTF-8 encoded and NULL terminated.
+ * \param w Filled with the width of the text (may be NULL)
+ * \param h Filled with the height of the text (may be NULL)
+ * \return true on success or false on failure; call SDL_GetError() for more
+ * information.
+ *
+ * \sa DBGP_MeasureText
+ */
+bool DBGP_ColorMeasureText(
+    const DBGP_Font* font, const char* str, int* w, int* h);
+
+/**
+ * \fn bool DBGP_PrintWrapped(DBGP_Font* font, SDL_Renderer* renderer,
+ * const SDL_Rect* box, Uint8 colors, int flags, const char* str)
+ * \brief Draws some text wrapped inside a box. String must be UTF-8 encoded
+ * and NULL terminated.
+ *
+ * Same as DBGP_ColorPrint, but lines longer than the box width are broken
+ * between words (or between glyphs with DBGP_WRAP_CHAR; words longer than a
+ * line are always broken between glyphs). Spaces at line breaks are not
+ * drawn, and color escape codes don't count toward the line width. Lines that
+ * don't fit entirely in the box height are not drawn. Wide codepoints count
+ * as two cells. Positioning and repeat escape codes aren't supported (they
+ * are drawn as is), and neither are tabs.
+ *
+ * To draw the same text every frame, a DBGP_TextLayout avoids computing line
+ * breaks again.
+ *
+ * \param font The font to draw with
+ * \param renderer The rendering context
+ * \param box The box to draw the text in
+ * \param colors The colors that will be used to draw, in the same format as
+ * DBGP_ColorPrint
+ * \param flags A combination of one DBGP_WRAP_* and one DBGP_ALIGN_* flag
+ * \param str The text to draw. Must be UTF-8 encoded and NULL terminated.
+ * \return true on success or false on failure; call SDL_GetError() for more
+ * information.
+ *
+ * \sa DBGP_ColorPrint
+ * \sa DBGP_UpdateTextLayout
+ */
+bool DBGP_PrintWrapped(
+    DBGP_Font* font, SDL_Renderer* renderer, const SDL_Rect* box, Uint8 colors,
+    int flags, const char* str);
+
+/**
+ * \fn bool DBGP_RenderCells(DBGP_Font* font, SDL_Renderer* renderer, int x,
+ * int y, const Uint16* cells, int cols, int rows, int stride)
+ * \brief Draws a grid of character cells, like a VGA text mode screen.
+ *
+ * Each cell holds a glyph index in its low byte and colors in its high byte,
+ * in the same format as DBGP_ColorPrint (see DBGP_CELL). Glyph indices
+ * address the glyphs of the font directly: no string is decoded, the
+ * codepoint table and fallbacks of the font are not used, and cells whose
+ * glyph index is out of range only draw their background.
+ *
+ * Cells are converted to geometry in a single pass, with larger batches than
+ * the print functions: an 80x25 screen is drawn with 2 SDL_RenderGeometry
+ * calls, or 5 when every cell has a background color. Cells can't be drawn
+ * while an overlay cache is recording on the renderer.
+ *
+ * \param font The font to draw with
+ * \param renderer The rendering context
+ * \param x The X coordinate of the grid
+ * \param y The Y coordinate of the grid
+ * \param cells The cells, row by row
+ * \param cols The number of columns of the grid
+ * \param rows The number of rows of the grid
+ * \param stride The number of cells between the starts of two rows in cells
+ * (0 if it's cols)
+ * \return true on success or false on failure; call SDL_GetError() for more
+ * information.
+ *
+ * \sa DBGP_RenderCells32
+ */
+bool DBGP_RenderCells(
+    DBGP_Font* font, SDL_Renderer* renderer, int x, int y,
+    const Uint16* cells, int cols, int rows, int stride);
+
+/**
+ * \fn bool DBGP_RenderCells32(DBGP_Font* font, SDL_Renderer* renderer, int x,
+ * int y, const Uint32* cells, int cols, int rows, int stride)
+ * \brief Draws a grid of 32-bit character cells.
+ *
+ * Same as DBGP_RenderCells, but each cell holds a glyph index in its 24 low
+ * bits and colors in its 8 high bits (see DBGP_CELL32), for fonts having more
+ * than 256 glyphs.
+ *
+ * \param font The font to draw with
+ * \param renderer The rendering context
+ * \param x The X coordinate of the grid
+ * \param y The Y coordinate of the grid
+ * \param cells The cells, row by row
+ * \param cols The number of columns of the grid
+ * \param rows The number of rows of the grid
+ * \param stride The number of cells between the starts of two rows in cells
+ * (0 if it's cols)
+ * \return true on success or false on failure; call SDL_GetError() for more
+ * information.
+ *
+ * \sa DBGP_RenderCells
+ */
+bool DBGP_RenderCells32(
+    DBGP_Font* font, SDL_Renderer* renderer, int x, int y,
+    const Uint32* cells, int cols, int rows, int stride);
+
+/**
+ * \struct DBGP_CompiledGlyph
+ * \brief A glyph of a string laid out ahead of time, for DBGP_RenderCompiled.
+ *
+ * Arrays of compiled glyphs are usually generated at compile time from string
+ * literals by DBGP::Compile (see SDL_DBGP.hpp).
+ *
+ * \sa DBGP_RenderCompiled
+ */
+struct DBGP_CompiledGlyph {
+  Uint32 glyph; /**< the index of the glyph in the font */
+  Uint16 column; /**< the column of the glyph, from the start of its line */
+  Uint16 line; /**< the line of the glyph, from the first line */
+  Uint8 colors; /**< the colors of the glyph, as in DBGP_ColorPrint */
+};
+typedef struct DBGP_CompiledGlyph
+    DBGP_CompiledGlyph; /**< Convenience typedef */
+
+/**
+ * \fn bool DBGP_RenderCompiled(DBGP_Font* font, SDL_Renderer* renderer,
+ * int x, int y, const DBGP_CompiledGlyph* glyphs, int nb_glyphs)
+ * \brief Draws a string compiled ahead of time into glyphs.
+ *
+ * No string is decoded: like DBGP_RenderCells, glyph indices address the
+ * glyphs of the font directly, and glyphs whose index is out of range only
+ * draw their background. Each glyph is drawn at (x + column * glyph_width,
+ * y + line * glyph_height).
+ *
+ * \param font The font to draw with
+ * \param renderer The rendering context
+ * \param x The X coordinate of the text
+ * \param y The Y coordinate of the text
+ * \param glyphs The glyphs to draw
+ * \param nb_glyphs The number of glyphs in glyphs
+ * \return true on success or false on failure; call SDL_GetError() for more
+ * information.
+ *
+ * \sa DBGP_ColorPrint
+ * \sa DBGP_RenderCells
+ */
+bool DBGP_RenderCompiled(
+    DBGP_Font* font, SDL_Renderer* renderer, int x, int y,
+    const DBGP_CompiledGlyph* glyphs, int nb_glyphs);
+
+/**
+ * \fn bool DBGP_BeginBatch(SDL_Renderer* renderer)
+ * \brief Starts batching the text drawn on a renderer across calls.
+ *
+ * Until DBGP_EndBatch is called, the functions drawing text on the renderer
+ * queue their backgrounds and glyphs into a single batch, instead of drawing
+ * them at the end of each call. Queued quads are drawn with one
+ * SDL_RenderGeometry call per texture in use (and one for the backgrounds)
+ * when the batch is full or ended: fonts sharing a texture (see
+ * DBGP_CreateFontGroup) don't split the batch.
+ *
+ * Within a batch, the backgrounds are drawn before the glyphs, and anything
+ * else drawn on the renderer (overlay cache textures included) is drawn
+ * before the queued text. The queued vertices are in the frame arena: while
+ * a batch is open, DBGP_ResetFrameArena does nothing and DBGP_SetAllocator
+ * fails.
+ *
+ * \param renderer The rendering context
+ * \return true on success or false on failure (e.g. a batch is already open);
+ * call SDL_GetError() for more information.
+ *
+ * \sa DBGP_EndBatch
+ */
+bool DBGP_BeginBatch(SDL_Renderer* renderer);
+
+/**
+ * \fn bool DBGP_EndBatch(SDL_Renderer* renderer)
+ * \brief Draws the text queued since DBGP_BeginBatch, and stops batching.
+ *
+ * \param renderer The rendering context
+ * \return true on success or false on failure; call SDL_GetError() for more
+ * information.
+ *
+ * \sa DBGP_BeginBatch
+ */
+bool DBGP_EndBatch(SDL_Renderer* renderer);
+
+/**
+ * \struct DBGP_TextLine
+ * \brief A line of a DBGP_TextLayout.
+ */
+struct DBGP_TextLine {
+  Uint32 offset; /**< the offset in bytes of the line in the text */
+  Uint32 nb_glyphs; /**< the number of glyphs drawn on the line */
+  Uint32 nb_cells; /**< the width in cells of the line (wide glyphs take two
+                      cells, see DBGP_GetCodepointWidth) */
+  Uint8 colors; /**< the colors at the start of the line */
+};
+typedef struct DBGP_TextLine DBGP_TextLine; /**< Convenience typedef */
+
+/**
+ * \struct DBGP_TextParagraph
+ * \brief A paragraph (text between two `\n`) of a DBGP_TextLayout.
+ */
+struct DBGP_TextParagraph {
+  Uint64 hash; /**< hash of the paragraph bytes */
+  Uint32 offset; /**< the offset in bytes of the paragraph in the text */
+  Uint32 length; /**< the length in bytes of the paragraph */
+  Uint32 first_line; /**< the index of the first line of the paragraph */
+  Uint32 nb_lines; /**< the number of lines of the paragraph */
+  Uint8 start_colors; /**< the colors at the start of the paragraph */
+  Uint8 end_colors; /**< the colors at the end of the paragraph */
+};
+typedef struct DBGP_TextParagraph DBGP_TextParagraph; /**< Convenience
+                                                         typedef */
+
+/**
+ * \struct DBGP_TextLayout
+ * \brief Line breaks of a wrapped text, kept between frames.
+ *
+ * When the text is updated, only the paragraphs whose bytes changed are laid
+ * out again.
+ *
+ * This struct should be considered read-only.
+ *
+ * \sa DBGP_CreateTextLayout
+ * \sa DBGP_UpdateTextLayout
+ * \sa DBGP_RenderTextLayout
+ */
+struct DBGP_TextLayout {
+  DBGP_Font* font; /**< the font to draw with */
+  int flags; /**< DBGP_WRAP_* and DBGP_ALIGN_* flags */
+  int width; /**< the width in pixels of the layout */
+  Uint8 colors; /**< the colors at the start of the text */
+  const char* text; /**< the text, owned by the caller */
+  DBGP_TextLine* lines; /**< the lines of the text */
+  int nb_lines; /**< the number of lines */
+  DBGP_TextParagraph* paragraphs; /**< the paragraphs of the text */
+  int nb_paragraphs; /**< the number of paragraphs */
+  int nb_paragraphs_laid_out; /**< the number of paragraphs that were laid
+                                   out during the last update */
+  DBGP_TextLine* spare_lines; /**< storage reused by the next update */
+  DBGP_TextParagraph* spare_paragraphs; /**< storage reused by the next
+                                             update */
+  int lines_capacity; /**< capacity of lines and spare_lines */
+  int paragraphs_capacity; /**< capacity of paragraphs and spare_paragraphs */
+};
+typedef struct DBGP_TextLayout DBGP_TextLayout; /**< Convenience typedef */
+
+/**
+ * \fn bool DBGP_CreateTextLayout(DBGP_TextLayout* layout, DBGP_Font* font,
+ * int flags)
+ * \brief Initialises an empty text layout.
+ *
+ * \param layout The layout to initialise
+ * \param font The font to draw with
+ * \param flags A combination of one DBGP_WRAP_* and one DBGP_ALIGN_* flag
+ * \return true on success or false on failure; call SDL_GetError() for more
+ * information.
+ *
+ * \sa DBGP_DestroyTextLayout
+ * \sa DBGP_UpdateTextLayout
+ */
+bool DBGP_CreateTextLayout(
+    DBGP_TextLayout* layout, DBGP_Font* font, int flags);
+
+/**
+ * \fn void DBGP_DestroyTextLayout(DBGP_TextLayout* layout)
+ * \brief Frees all memory allocated by a text layout.
+ *
+ * \sa DBGP_CreateTextLayout
+ */
+void DBGP_DestroyTextLayout(DBGP_TextLayout* layout);
+
+/**
+ * \fn bool DBGP_UpdateTextLayout(DBGP_TextLayout* layout, const char* str,
+ * int width, Uint8 colors)
+ * \brief Computes the line breaks of a text.
+ *
+ * Paragraphs whose bytes (and starting colors) didn't change since the
+ * previous update keep their line breaks; changing the width or the colors
+ * lays out the whole text again. The text isn't copied: it must stay valid
+ * until the next update, and while the layout is rendered.
+ *
+ * \param layout The layout to update
+ * \param str The text to lay out. Must be UTF-8 encoded and NULL terminated.
+ * \param width The width in pixels of the layout
+ * \param colors The colors at the start of the text, in the same format as
+ * DBGP_ColorPrint
+ * \return true on success or false on failure; call SDL_GetError() for more
+ * information.
+ *
+ * \sa DBGP_RenderTextLayout
+ */
+bool DBGP_UpdateTextLayout(
+    DBGP_TextLayout* layout, const char* str, int width, Uint8 colors);
+
+/**
+ * \fn bool DBGP_RenderTextLayout(DBGP_TextLayout* layout,
+ * SDL_Renderer* renderer, int x, int y)
+ * \brief Draws a text layout on a renderer.
+ *
+ * \param layout The layout to draw
+ * \param renderer The rendering context
+ * \param x The X coordinate of the layout
+ * \param y The Y coordinate of the layout
+ * \return true on success or false on failure; call SDL_GetError() for more
+ * information.
+ *
+ * \sa DBGP_UpdateTextLayout
+ */
+bool DBGP_RenderTextLayout(
+    DBGP_TextLayout* layout, SDL_Renderer* renderer, int x, int y);
+
+/**
+ * \struct DBGP_TextView
+ * \brief A view over the lines of a large text (a log...), filtered by a
+ * substring.
+ *
+ * The offsets of the lines are indexed once, when the text is set. Filtering
+ * scans the text for the first byte of the filter (with memchr, see
+ * DBGP_USE_LIBC_MEMCHR) and compares the rest of the filter at each
+ * candidate; when the filter only gets longer (while it is typed), only the
+ * lines matching the previous filter are searched again. Drawing only reads
+ * the visible lines.
+ *
+ * This struct should be considered read-only.
+ *
+ * \sa DBGP_CreateTextView
+ * \sa DBGP_SetTextViewText
+ * \sa DBGP_FilterTextView
+ * \sa DBGP_RenderTextView
+ */
+struct DBGP_TextView {
+  DBGP_Font* font; /**< the font to draw with */
+  Uint8 colors; /**< the colors of the text, in the same format as
+                   DBGP_ColorPrint */
+  Uint8 highlight_colors; /**< the colors of the substrings matching the
+                             filter */
+  const char* text; /**< the text, owned by the caller */
+  size_t length; /**< the length in bytes of the text */
+  Uint32* lines; /**< the offset in bytes of each line in the text, followed
+                    by the offset after the last line end */
+  int nb_lines; /**< the number of lines */
+  int* matches; /**< the indices of the lines matching the filter (all the
+                   lines without filter), in order */
+  int nb_matches; /**< the number of lines matching the filter */
+  int lines_capacity; /**< the capacity of lines and matches */
+  char filter[DBGP_TEXT_VIEW_FILTER_SIZE]; /**< the filter ("" for none) */
+  size_t filter_length; /**< the length in bytes of the filter */
+};
+typedef struct DBGP_TextView DBGP_TextView; /**< Convenience typedef */
+
+/**
+ * \fn bool DBGP_CreateTextView(DBGP_TextView* view, DBGP_Font* font,
+ * Uint8 colors, Uint8 highlight_colors)
+ * \brief Initialises an empty text view, without filter.
+ *
+ * \param view The text view to initialise
+ * \param font The font to draw with
+ * \param colors The colors of the text, in the same format as
+ * DBGP_ColorPrint
+ * \param highlight_colors The colors of the substrings matching the filter
+ * \return true on success or false on failure; call SDL_GetError() for more
+ * information.
+ *
+ * \sa DBGP_DestroyTextView
+ * \sa DBGP_SetTextViewText
+ */
+bool DBGP_CreateTextView(
+    DBGP_TextView* view, DBGP_Font* font, Uint8 colors,
+    Uint8 highlight_colors);
+
+/**
+ * \fn void DBGP_DestroyTextView(DBGP_TextView* view)
+ * \brief Frees all memory allocated by a text view.
+ *
+ * \sa DBGP_CreateTextView
+ */
+void DBGP_DestroyTextView(DBGP_TextView* view);
+
+/**
+ * \fn bool DBGP_SetTextViewText(DBGP_TextView* view, const char* text,
+ * size_t length)
+ * \brief Sets the text of a view, indexes its lines and applies the filter
+ * again.
+ *
+ * Lines end with `\n` (a `\r` before it isn't drawn). The text isn't copied:
+ * it must stay valid until the next call, and while the view is rendered.
+ * Escape codes aren't parsed.
+ *
+ * \param view The text view
+ * \param text The text. Must be UTF-8 encoded; it doesn't need to be NULL
+ * terminated.
+ * \param length The length in bytes of the text (less than 4GB)
+ * \return true on success or false on failure; call SDL_GetError() for more
+ * information.
+ *
+ * \sa DBGP_FilterTextView
+ */
+bool DBGP_SetTextViewText(
+    DBGP_TextView* view, const char* text, size_t length);
+
+/**
+ * \fn bool DBGP_FilterTextView(DBGP_TextView* view, const char* filter)
+ * \brief Keeps the lines of a text view containing a substring.
+ *
+ * The comparison is case sensitive. Extending the previous filter (e.g. from
+ * "err" to "error") only searches the lines that matched it.
+ *
+ * \param view The text view
+ * \param filter The substring to search, without newline (NULL or "" to
+ * show every line)
+ * \return true on success or false on failure (e.g. the filter is longer
+ * than DBGP_TEXT_VIEW_FILTER_SIZE); call SDL_GetError() for more
+ * information.
+ *
+ * \sa DBGP_RenderTextView
+ */
+bool DBGP_FilterTextView(DBGP_TextView* view, const char* filter);
+
+/**
+ * \fn bool DBGP_RenderTextView(DBGP_TextView* view, SDL_Renderer* renderer,
+ * const SDL_Rect* box, int first)
+ * \brief Draws the lines of a text view matching its filter, from one of
+ * them, with the matching substrings highlighted.
+ *
+ * As many lines as fit in the box height are drawn, each clipped to the box
+ * width.
+ *
+ * \param view The text view
+ * \param renderer The rendering context
+ * \param box The box to draw the lines in
+ * \param first The index of the first matching line to draw (the scroll
+ * position, from 0 to nb_matches - 1)
+ * \return true on success or false on failure; call SDL_GetError() for more
+ * information.
+ *
+ * \sa DBGP_FilterTextView
+ */
+bool DBGP_RenderTextView(
+    DBGP_TextView* view, SDL_Renderer* renderer, const SDL_Rect* box,
+    int first);
+
+/**
+ * \fn bool DBGP_PrintToSurface(DBGP_Font* font, SDL_Surface* surface, int x,
+ * int y, SDL_Color bg_color, SDL_Color fg_color, const char* str)
+ * \brief Draws some text into a surface, without a renderer. String must be
+ * UTF-8 encoded and NULL terminated.
+ *
+ * Glyphs are drawn on the CPU, from the font bitmaps. Colors with an alpha
+ * lower than 255 are blended with the surface content. The surface clip
+ * rectangle is respected.
+ *
+ * \param font The font to draw with
+ * \param surface The surface to draw into. Must use a 32-bit pixel format such
+ * as SDL_PIXELFORMAT_ARGB8888 or SDL_PIXELFORMAT_RGBA8888.
+ * \param x The X coordinate of the text
+ * \param y The Y coordinate of the text
+ * \param bg_color Background color
+ * \param fg_color Foreground (text) color
+ * \param str The text to draw. Must be UTF-8 encoded and NULL terminated.
+ * \return true on success or false on failure; call SDL_GetError() for more
+ * information.
+ *
+ * \sa DBGP_Print
+ * \sa DBGP_ColorPrintToSurface
+ */
+bool DBGP_PrintToSurface(
+    DBGP_Font* font, SDL_Surface* surface, int x, int y, SDL_Color bg_color,
+    SDL_Color fg_color, const char* str);
+
+/**
+ * \fn bool DBGP_ColorPrintToSurface(DBGP_Font* font, SDL_Surface* surface,
+ * int x, int y, Uint8 colors, const char* str)
+ * \brief Draws some text into a surface, without a renderer. String must be
+ * UTF-8 encoded and NULL terminated.
+ *
+ * Same as DBGP_ColorPrint (including escape codes), but glyphs are drawn
+ * on the CPU into a 32-bit surface. See DBGP_PrintToSurface.
+ *
+ * \param font The font to draw with
+ * \param surface The surface to draw into. Must use a 32-bit pixel format.
+ * \param x The X coordinate of the text
+ * \param y The Y coordinate of the text
+ * \param colors The colors that will be used to draw (4 most significant
+ * bits correspond to the background color, 4 least significant bits correspond
+ * to the foreground color)
+ * \param str The text to draw. Must be UTF-8 encoded and NULL terminated.
+ * \return true on success or false on failure; call SDL_GetError() for more
+ * information.
+ *
+ * \sa DBGP_ColorPrint
+ * \sa DBGP_PrintToSurface
+ */
+bool DBGP_ColorPrintToSurface(
+    DBGP_Font* font, SDL_Surface* surface, int x, int y, Uint8 colors,
+    const char* str);
+
+/**
+ * \fn int DBGP_BuildGeometry(DBGP_Font* font, int x, int y,
+ * SDL_Color bg_color, SDL_Color fg_color, const char* str,
+ * SDL_Vertex* vertices, int* indices, int max_quads)
+ * \brief Lays out some text like DBGP_Print, writing its quads into caller
+ * arrays instead of drawing them, for renderers other than SDL_Renderer.
+ *
+ * Each quad is 4 vertices (positions in pixels, colors, and texture
+ * coordinates normalized to the atlas of DBGP_GetFontAtlasPixels) and 6
+ * indices (2 triangles) into the vertices array; add the index of the first
+ * vertex to them when appending the quads to a larger vertex buffer.
+ * Backgrounds are drawn before their glyph, from a white texel of the atlas,
+ * so text can be drawn with a single draw call. Glyphs missing from the font
+ * (including those of its fallbacks) only draw their background, and font
+ * styles are ignored.
+ *
+ * Pass NULL vertices and indices to only compute the number of quads needed.
+ *
+ * This function doesn't use any renderer or global state, so it may be called
+ * from any thread, even while other text is drawn with SDL_Renderer, as long
+ * as no other thread uses the font at the same time (see
+ * DBGP_SetFontFallbacks).
+ *
+ * \param font The font to lay the text out with. It may have been created
+ * without a renderer.
+ * \param x The X coordinate of the text
+ * \param y The Y coordinate of the text
+ * \param bg_color Background color
+ * \param fg_color Foreground (text) color
+ * \param str The text to lay out. Must be UTF-8 encoded and NULL terminated.
+ * \param vertices The array receiving max_quads * 4 vertices, or NULL
+ * \param indices The array receiving max_quads * 6 indices, or NULL
+ * \param max_quads The number of quads the arrays can hold
+ * \return the number of quads of the text (only the first max_quads are
+ * written), or -1 on failure.
+ *
+ * \sa DBGP_ColorBuildGeometry
+ * \sa DBGP_GetFontAtlasPixels
+ */
+int DBGP_BuildGeometry(
+    DBGP_Font* font, int x, int y, SDL_Color bg_color, SDL_Color fg_color,
+    const char* str, SDL_Vertex* vertices, int* indices, int max_quads);
+
+/**
+ * \fn int DBGP_ColorBuildGeometry(DBGP_Font* font, int x, int y,
+ * Uint8 colors, const char* str, SDL_Vertex* vertices, int* indices,
+ * int max_quads)
+ * \brief Lays out some text like DBGP_ColorPrint (including color escape
+ * codes), writing its quads into caller arrays instead of drawing them.
+ *
+ * See DBGP_BuildGeometry.
+ *
+ * \param font The font to lay the text out with
+ * \param x The X coordinate of the text
+ * \param y The Y coordinate of the text
+ * \param colors The colors that will be used to draw (4 most significant
+ * bits correspond to the background color, 4 least significant bits correspond
+ * to the foreground color)
+ * \param str The text to lay out. Must be UTF-8 encoded and NULL terminated.
+ * \param vertices The array receiving max_quads * 4 vertices, or NULL
+ * \param indices The array receiving max_quads * 6 indices, or NULL
+ * \param max_quads The number of quads the arrays can hold
+ * \return the number of quads of the text (only the first max_quads are
+ * written), or -1 on failure.
+ *
+ * \sa DBGP_BuildGeometry
+ */
+int DBGP_ColorBuildGeometry(
+    DBGP_Font* font, int x, int y, Uint8 colors, const char* str,
+    SDL_Vertex* vertices, int* indices, int max_quads);
+
+/**
+ * \fn bool DBGP_GetFontAtlasPixels(const DBGP_Font* font, void* pixels,
+ * int* width, int* height)
+ * \brief Draws the atlas the quads of DBGP_BuildGeometry are textured with.
+ *
+ * The atlas holds the glyphs of the font in a grid, followed by a white cell
+ * for backgrounds. Its texels are either opaque white or transparent black,
+ * so it reads the same in any 32-bit format (e.g. SDL_PIXELFORMAT_RGBA32);
+ * sample it with nearest filtering.
+ *
+ * Pass NULL pixels to only get the size of the atlas.
+ *
+ * \param font The font to draw the atlas of
+ * \param pixels The buffer receiving width * height 32-bit texels (without
+ * padding between rows), or NULL
+ * \param width Filled with the width of the atlas in pixels, may be NULL
+ * \param height Filled with the height of the atlas in pixels, may be NULL
+ * \return true on success or false on failure.
+ *
+ * \sa DBGP_BuildGeometry
+ */
+bool DBGP_GetFontAtlasPixels(
+    const DBGP_Font* font, void* pixels, int* width, int* height);
+
+/**
+ * \struct DBGP_ANSIStream
+ * \brief State of an incremental ANSI/VT100 escape sequence parser.
+ *
+ * Data can be written to a stream in chunks of any size: escape sequences and
+ * UTF-8 sequences may be split across several calls to DBGP_WriteANSI.
+ *
+ * This struct should be considered read-only.
+ *
+ * \sa DBGP_InitANSIStream
+ * \sa DBGP_WriteANSI
+ */
+struct DBGP_ANSIStream {
+  DBGP_Font* font; /**< the font to draw with */
+  int x; /**< the X coordinate of the first column */
+  int y; /**< the Y coordinate of the first line */
+  int column; /**< the cursor column, in glyphs */
+  int line; /**< the cursor line, in glyphs */
+  int prev_width; /**< the width in columns of the codepoint before the
+                     cursor, where combining marks are drawn (0 after the
+                     cursor moved) */
+  Uint8 colors; /**< the current colors, same format as DBGP_ColorPrint */
+  Uint8 default_colors; /**< the colors restored by `ESC[0m` */
+  Uint8 fg; /**< the current foreground color, before bold and reverse */
+  Uint8 bg; /**< the current background color, before reverse */
+  bool bold; /**< whether bold (bright foreground) is enabled */
+  bool reverse; /**< whether foreground and background are swapped */
+  Uint8 state; /**< internal parser state */
+  Uint8 utf8_remaining; /**< number of UTF-8 continuation bytes expected */
+  Uint32 codepoint; /**< the codepoint being decoded */
+  Uint32 codepoint_min; /**< smallest valid value for the codepoint being
+                           decoded, used to reject overlong sequences */
+  int nb_params; /**< number of parameters of the current sequence */
+  int params[DBGP_ANSI_MAX_PARAMS]; /**< parameters of the current sequence */
+  bool subparams[DBGP_ANSI_MAX_PARAMS]; /**< whether each parameter is a
+                                           sub-parameter (follows a ':') */
+};
+typedef struct DBGP_ANSIStream DBGP_ANSIStream; /**< Convenience typedef */
+
+/**
+ * \fn void DBGP_InitANSIStream(DBGP_ANSIStream* stream, DBGP_Font* font,
+ * int x, int y, Uint8 colors)
+ * \brief Initialises an ANSI stream, placing its cursor at (x, y).
+ *
+ * \param stream The stream to initialise
+ * \param font The font to draw with
+ * \param x The X coordinate of the first column
+ * \param y The Y coordinate of the first line
+ * \param colors The default colors, in the same format as DBGP_ColorPrint
+ *
+ * \sa DBGP_WriteANSI
+ */
+void DBGP_InitANSIStream(
+    DBGP_ANSIStream* stream, DBGP_Font* font, int x, int y, Uint8 colors);
+
+/**
+ * \fn bool DBGP_WriteANSI(DBGP_ANSIStream* stream, SDL_Renderer* renderer,
+ * const void* data, size_t len)
+ * \brief Parses a chunk of UTF-8 text containing ANSI escape sequences and
+ * draws it on a renderer.
+ *
+ * Chunks don't need to be aligned on sequences: parser state is kept in the
+ * stream between calls. SGR sequences (`ESC[...m`) are mapped onto the
+ * 16-color palette used by DBGP_ColorPrint: normal, bright (90-97, 100-107),
+ * bold, reverse, and 256-color/true-color sequences (matched to the nearest
+ * palette entry, in both their `;` and `:` forms) are supported. Carriage
+ * return, backspace, tabs, and cursor movement sequences (`A`, `B`, `C`, `D`,
+ * `G`, `H`) move the cursor. `\n` moves the cursor to the start of the next
+ * line. Other sequences are ignored.
+ *
+ * \param stream The stream to write to
+ * \param renderer The rendering context
+ * \param data The bytes to parse
+ * \param len The number of bytes in data
+ * \return true on success or false on failure; call SDL_GetError() for more
+ * information.
+ *
+ * \sa DBGP_InitANSIStream
+ */
+bool DBGP_WriteANSI(
+    DBGP_ANSIStream* stream, SDL_Renderer* renderer, const void* data,
+    size_t len);
+
+/**
+ * \struct DBGP_OverlayCache
+ * \brief Caches the text drawn in a frame into a texture, redrawn only when
+ * the text changes.
+ *
+ * Between DBGP_BeginOverlayCache and DBGP_EndOverlayCache, the print
+ * functions called with the renderer of the cache are recorded instead of
+ * drawn, and hashed (font, position, colors, string bytes). When the hash
+ * matches the text drawn in the cache texture, the texture is drawn again
+ * as is: the cost of an unchanged overlay is hashing plus one texture draw.
+ *
+ * This struct should be considered read-only.
+ *
+ * \sa DBGP_CreateOverlayCache
+ * \sa DBGP_BeginOverlayCache
+ * \sa DBGP_EndOverlayCache
+ */
+struct DBGP_OverlayCache {
+  SDL_Renderer* renderer; /**< the rendering context */
+  SDL_Texture* texture; /**< the texture the text is cached in */
+  int width; /**< the width in pixels of the overlay */
+  int height; /**< the height in pixels of the overlay */
+  Uint64 min_update_interval; /**< the minimum time in nanoseconds between two
+                                 updates of the texture (0 for no limit) */
+  Uint64 last_update; /**< the time in nanoseconds (SDL_GetTicksNS) of the
+                         last update of the texture */
+  Uint64 hash; /**< hash of the calls recorded during the current frame */
+  Uint64 cached_hash; /**< hash of the calls drawn in the texture */
+  Uint64 nb_updates; /**< the number of times the texture was redrawn */
+  Uint8* commands; /**< the calls recorded during the current frame */
+  size_t commands_size; /**< the size in bytes of commands */
+  size_t commands_capacity; /**< the capacity in bytes of commands */
+};
+typedef struct DBGP_OverlayCache DBGP_OverlayCache; /**< Convenience typedef */
+
+/**
+ * \fn bool DBGP_CreateOverlayCache(DBGP_OverlayCache* cache,
+ * SDL_Renderer* renderer, int width, int height, float max_update_rate)
+ * \brief Initialises an overlay cache, and creates its texture.
+ *
+ * The overlay covers the rectangle (0, 0, width, height) of the renderer.
+ * With a max_update_rate of 10, the texture is redrawn at most 10 times per
+ * second even if the text changes every frame; the last drawn text is shown
+ * in the meantime.
+ *
+ * The texture content is lost on SDL_EVENT_RENDER_TARGETS_RESET: call
+ * DBGP_InvalidateOverlayCache when it happens.
+ *
+ * \param cache The overlay cache to initialise
+ * \param renderer The rendering context
+ * \param width The width in pixels of the overlay
+ * \param height The height in pixels of the overlay
+ * \param max_update_rate The maximum number of texture updates per second
+ * (0 for no limit)
+ * \return true on success or false on failure; call SDL_GetError() for more
+ * information.
+ *
+ * \sa DBGP_DestroyOverlayCache
+ * \sa DBGP_BeginOverlayCache
+ */
+bool DBGP_CreateOverlayCache(
+    DBGP_OverlayCache* cache, SDL_Renderer* renderer, int width, int height,
+    float max_update_rate);
+
+/**
+ * \fn void DBGP_DestroyOverlayCache(DBGP_OverlayCache* cache)
+ * \brief Destroys the texture and frees all memory of an overlay cache.
+ *
+ * \sa DBGP_CreateOverlayCache
+ */
+void DBGP_DestroyOverlayCache(DBGP_OverlayCache* cache);
+
+/**
+ * \fn void DBGP_InvalidateOverlayCache(DBGP_OverlayCache* cache)
+ * \brief Forces the next DBGP_EndOverlayCache call to redraw the texture.
+ *
+ * \sa DBGP_EndOverlayCache
+ */
+void DBGP_InvalidateOverlayCache(DBGP_OverlayCache* cache);
+
+/**
+ * \fn bool DBGP_BeginOverlayCache(DBGP_OverlayCache* cache)
+ * \brief Starts recording the text of the overlay for the current frame.
+ *
+ * Until DBGP_EndOverlayCache is called, DBGP_Print, DBGP_Printf,
+ * DBGP_ColorPrint, DBGP_ColorPrintf and DBGP_PrintWrapped calls (and
+ * DBGP_RenderOverlay, which uses DBGP_ColorPrint) using the renderer of the
+ * cache are recorded instead of drawn. The other drawing functions
+ * (DBGP_RenderCells, DBGP_RenderCells32, DBGP_RenderCompiled,
+ * DBGP_RenderTextLayout, DBGP_RenderTextView, DBGP_WriteANSI and
+ * DBGP_RenderPerfHUD) fail on that renderer meanwhile. Only one overlay cache
+ * can record at a time.
+ *
+ * \param cache The overlay cache
+ * \return true on success or false on failure; call SDL_GetError() for more
+ * information.
+ *
+ * \sa DBGP_EndOverlayCache
+ */
+bool DBGP_BeginOverlayCache(DBGP_OverlayCache* cache);
+
+/**
+ * \fn bool DBGP_EndOverlayCache(DBGP_OverlayCache* cache)
+ * \brief Stops recording, and draws the overlay.
+ *
+ * The recorded calls are drawn into the cache texture if their hash differs
+ * from the one of the texture content (and the maximum update rate allows
+ * it), then the texture is drawn on the renderer.
+ *
+ * \param cache The overlay cache
+ * \return true on success or false on failure; call SDL_GetError() for more
+ * information.
+ *
+ * \sa DBGP_BeginOverlayCache
+ */
+bool DBGP_EndOverlayCache(DBGP_OverlayCache* cache);
+
+/**
+ * \struct DBGP_PerfStats
+ * \brief Statistics of the samples of a performance HUD series.
+ */
+struct DBGP_PerfStats {
+  float last; /**< the last sample */
+  float min; /**< the smallest sample */
+  float avg; /**< the average of the samples */
+  float max; /**< the largest sample */
+  float p50; /**< the median of the samples */
+  float p95; /**< the 95th percentile of the samples */
+  float p99; /**< the 99th percentile of the samples */
+};
+typedef struct DBGP_PerfStats DBGP_PerfStats; /**< Convenience typedef */
+
+/**
+ * \struct DBGP_PerfSeries
+ * \brief The samples of a series of a DBGP_PerfHUD (frame time, update time,
+ * a counter...).
+ *
+ * This struct should be considered read-only, except for scale.
+ */
+struct DBGP_PerfSeries {
+  char name[DBGP_PERF_NAME_SIZE]; /**< the name of the series */
+  Uint8 colors; /**< the colors of the series, in the same format as
+                   DBGP_ColorPrint */
+  float scale; /**< the value at the top of the graph (0 to fit the largest
+                  sample) */
+  float* samples; /**< ring buffer of the last samples */
+  int nb_samples; /**< the number of samples in the ring buffer */
+  int next; /**< the index in samples of the next sample */
+  DBGP_PerfStats stats; /**< the statistics drawn by DBGP_RenderPerfHUD */
+  bool stats_outdated; /**< whether samples were added since stats was
+                          computed */
+};
+typedef struct DBGP_PerfSeries DBGP_PerfSeries; /**< Convenience typedef */
+
+/**
+ * \struct DBGP_PerfHUD
+ * \brief Keeps the last samples of a few series, and draws their statistics
+ * and graphs.
+ *
+ * This struct should be considered read-only.
+ *
+ * \sa DBGP_CreatePerfHUD
+ * \sa DBGP_AddPerfSample
+ * \sa DBGP_RenderPerfHUD
+ */
+struct DBGP_PerfHUD {
+  int capacity; /**< the number of samples kept per series */
+  int graph_width; /**< the width in glyphs of the graphs */
+  int graph_height; /**< the height in glyphs of the graphs */
+  int nb_series; /**< the number of series */
+  DBGP_PerfSeries series[DBGP_PERF_MAX_SERIES]; /**< the series */
+};
+typedef struct DBGP_PerfHUD DBGP_PerfHUD; /**< Convenience typedef */
+
+/**
+ * \fn bool DBGP_CreatePerfHUD(DBGP_PerfHUD* hud, int capacity,
+ * int graph_width, int graph_height)
+ * \brief Initialises a performance HUD without any series.
+ *
+ * \param hud The performance HUD to initialise
+ * \param capacity The number of samples kept per series
+ * \param graph_width The width in glyphs of the graphs (the samples are
+ * grouped in graph_width columns, showing their largest value)
+ * \param graph_height The height in glyphs of the graphs
+ * \return true on success or false on failure; call SDL_GetError() for more
+ * information.
+ *
+ * \sa DBGP_DestroyPerfHUD
+ * \sa DBGP_AddPerfSeries
+ */
+bool DBGP_CreatePerfHUD(
+    DBGP_PerfHUD* hud, int capacity, int graph_width, int graph_height);
+
+/**
+ * \fn void DBGP_DestroyPerfHUD(DBGP_PerfHUD* hud)
+ * \brief Frees all memory of a performance HUD.
+ *
+ * \sa DBGP_CreatePerfHUD
+ */
+void DBGP_DestroyPerfHUD(DBGP_PerfHUD* hud);
+
+/**
+ * \fn int DBGP_AddPerfSeries(DBGP_PerfHUD* hud, const char* name,
+ * Uint8 colors)
+ * \brief Adds a series to a performance HUD, and allocates its samples.
+ *
+ * \param hud The performance HUD
+ * \param name The name displayed before the statistics of the series
+ * \param colors The colors of the series text and graph, in the same format
+ * as DBGP_ColorPrint
+ * \return the index of the series, or -1 on failure; call SDL_GetError() for
+ * more information.
+ *
+ * \sa DBGP_AddPerfSample
+ */
+int DBGP_AddPerfSeries(DBGP_PerfHUD* hud, const char* name, Uint8 colors);
+
+/**
+ * \fn void DBGP_AddPerfSample(DBGP_PerfHUD* hud, int series, float value)
+ * \brief Records a sample of a series, replacing its oldest sample when the
+ * series is full.
+ *
+ * This runs in constant time and never allocates memory.
+ *
+ * \param hud The performance HUD
+ * \param series The index of the series, as returned by DBGP_AddPerfSeries
+ * \param value The sample (a duration in milliseconds, a counter...)
+ *
+ * \sa DBGP_RenderPerfHUD
+ */
+void DBGP_AddPerfSample(DBGP_PerfHUD* hud, int series, float value);
+
+/**
+ * \fn bool DBGP_GetPerfStats(const DBGP_PerfHUD* hud, int series,
+ * DBGP_PerfStats* stats)
+ * \brief Computes the statistics of the samples of a series.
+ *
+ * \param hud The performance HUD
+ * \param series The index of the series
+ * \param stats Filled with the statistics (all 0 if the series has no
+ * samples)
+ * \return true on success or false on failure; call SDL_GetError() for more
+ * information.
+ */
+bool DBGP_GetPerfStats(
+    const DBGP_PerfHUD* hud, int series, DBGP_PerfStats* stats);
+
+/**
+ * \fn bool DBGP_RenderPerfHUD(DBGP_PerfHUD* hud, DBGP_Font* font,
+ * SDL_Renderer* renderer, int x, int y, int flags)
+ * \brief Draws the statistics and the graph of each series of a performance
+ * HUD.
+ *
+ * Each series is drawn as a line of text (name, last sample, minimum,
+ * average, maximum, median, 95th and 99th percentiles) followed by its graph,
+ * graph_height glyphs high, the most recent samples on the right. Graphs use
+ * the background color of their series, unless it is 0 (transparent).
+ *
+ * The text and graphs are queued into a single batch sized for the whole
+ * HUD: it is drawn with one SDL_RenderGeometry call for the backgrounds and
+ * one per texture in use (one without fallback fonts), whatever the number of
+ * series, samples and the size of the graphs (unless a batch opened by
+ * DBGP_BeginBatch is in use). The statistics of a series are only computed
+ * again when samples were added since the last call. The HUD can't be drawn
+ * while an overlay cache is recording on the renderer.
+ *
+ * \param hud The performance HUD
+ * \param font The font to draw with
+ * \param renderer The rendering context
+ * \param x The X coordinate of the HUD
+ * \param y The Y coordinate of the HUD
+ * \param flags DBGP_PERF_GRAPH_AUTO or DBGP_PERF_GRAPH_RECTS
+ * \return true on success or false on failure; call SDL_GetError() for more
+ * information.
+ *
+ * \sa DBGP_AddPerfSample
+ * \sa DBGP_GetPerfStats
+ */
+bool DBGP_RenderPerfHUD(
+    DBGP_PerfHUD* hud, DBGP_Font* font, SDL_Renderer* renderer, int x, int y,
+    int flags);
+
+/**
+ * \fn bool DBGP_StartTrace(SDL_IOStream* dst, bool closeio)
+ * \brief Starts writing the print calls into a binary trace.
+ *
+ * Until DBGP_StopTrace is called, every call of DBGP_Print, DBGP_Printf,
+ * DBGP_ColorPrint, DBGP_ColorPrintf and DBGP_PrintWrapped (on any renderer)
+ * is written into the trace: the font (glyph height and number of glyphs
+ * only), position, colors and string after formatting. Call DBGP_TraceFrame
+ * at the end of each frame.
+ *
+ * Traces can be replayed with the `replay` program, built along the
+ * example, to measure the time spent drawing each frame with the software
+ * renderer. Records are buffered in DBGP_TRACE_BUFFER_SIZE bytes, written
+ * at the end of each frame. The format is described by DBGP_TRACE_VERSION.
+ *
+ * \param dst The stream the trace is written to
+ * \param closeio If true, calls SDL_CloseIO() on dst when the trace stops,
+ * even in the case of an error
+ * \return true on success or false on failure (e.g. a trace is already being
+ * written); call SDL_GetError() for more information.
+ *
+ * \sa DBGP_TraceFrame
+ * \sa DBGP_StopTrace
+ */
+bool DBGP_StartTrace(SDL_IOStream* dst, bool closeio);
+
+/**
+ * \fn bool DBGP_TraceFrame(void)
+ * \brief Marks the end of a frame in the trace, and writes the buffered
+ * records.
+ *
+ * \return true on success or false on failure (no trace or a write error);
+ * call SDL_GetError() for more information.
+ *
+ * \sa DBGP_StartTrace
+ */
+bool DBGP_TraceFrame(void);
+
+/**
+ * \fn bool DBGP_StopTrace(void)
+ * \brief Writes the buffered records, and stops tracing.
+ *
+ * \return true on success or false on failure (no trace, or a write error
+ * happened since DBGP_StartTrace); call SDL_GetError() for more information.
+ *
+ * \sa DBGP_StartTrace
+ */
+bool DBGP_StopTrace(void);
+
+/**
+ * \struct DBGP_Overlay
+ * \brief Text published by a producer thread (an audio callback, a
+ * streaming thread...) and drawn by the render thread, triple buffered.
+ *
+ * The producer writes a whole snapshot of the text into its back buffer, then
+ * exchanges it with the shared buffer in a single atomic operation. The
+ * render thread exchanges its front buffer with the shared buffer when it
+ * holds a newer snapshot, and draws it: only the most recent complete
+ * snapshot is drawn, without locks, and snapshots published in between are
+ * dropped.
+ *
+ * An overlay has a single producer thread at a time. This struct should be
+ * considered read-only.
+ *
+ * \sa DBGP_CreateOverlay
+ * \sa DBGP_OverlayPrint
+ * \sa DBGP_RenderOverlay
+ */
+struct DBGP_Overlay {
+  char* buffers; /**< the three buffers of capacity bytes each */
+  size_t capacity; /**< the capacity in bytes of a buffer (NULL character
+                      included) */
+  int back; /**< the index of the buffer written by the producer */
+  int front; /**< the index of the buffer drawn by the render thread */
+  SDL_AtomicInt shared; /**< the index of the buffer between the threads,
+                           flagged while it holds an unread snapshot */
+};
+typedef struct DBGP_Overlay DBGP_Overlay; /**< Convenience typedef */
+
+/**
+ * \fn bool DBGP_CreateOverlay(DBGP_Overlay* overlay, size_t capacity)
+ * \brief Initialises an overlay, and allocates its three buffers.
+ *
+ * The overlay is empty until the first snapshot is published.
+ *
+ * \param overlay The overlay to initialise
+ * \param capacity The capacity in bytes of the text (NULL character
+ * included); longer snapshots are truncated
+ * \return true on success or false on failure; call SDL_GetError() for more
+ * information.
+ *
+ * \sa DBGP_DestroyOverlay
+ * \sa DBGP_OverlayPrint
+ */
+bool DBGP_CreateOverlay(DBGP_Overlay* overlay, size_t capacity);
+
+/**
+ * \fn void DBGP_DestroyOverlay(DBGP_Overlay* overlay)
+ * \brief Frees the buffers of an overlay.
+ *
+ * Neither thread may use the overlay anymore.
+ *
+ * \sa DBGP_CreateOverlay
+ */
+void DBGP_DestroyOverlay(DBGP_Overlay* overlay);
+
+/**
+ * \fn void DBGP_OverlayPrint(DBGP_Overlay* overlay, const char* str)
+ * \brief Publishes a snapshot of the text of an overlay, from the producer
+ * thread.
+ *
+ * This copies the string and exchanges the buffer with a single atomic
+ * operation: it is wait-free and never allocates memory, so it can be called
+ * from real-time threads.
+ *
+ * \param overlay The overlay
+ * \param str The text, in the same format as DBGP_ColorPrint. Must be UTF-8
+ * encoded.
+ *
+ * \sa DBGP_OverlayPrintf
+ * \sa DBGP_RenderOverlay
+ */
+void DBGP_OverlayPrint(DBGP_Overlay* overlay, const char* str);
+
+/**
+ * \fn void DBGP_OverlayPrintf(DBGP_Overlay* overlay, const char* fmt, ...)
+ * \brief Formats a snapshot of the text of an overlay, and publishes it.
+ *
+ * The string is formatted on the stack, in at most DBGP_MAX_STR_LEN bytes
+ * (like DBGP_Printf), then copied as by DBGP_OverlayPrint: it is wait-free
+ * and never allocates memory.
+ *
+ * \param overlay The overlay
+ * \param fmt The string to format. Must be UTF-8 encoded and NULL terminated.
+ * \param ... Variable arguments to format the string with
+ *
+ * \sa DBGP_OverlayPrint
+ */
+void DBGP_OverlayPrintf(DBGP_Overlay* overlay, const char* fmt, ...);
+
+/**
+ * \fn const char* DBGP_GetOverlayText(DBGP_Overlay* overlay)
+ * \brief Returns the most recent snapshot of an overlay, from the render
+ * thread.
+ *
+ * The string stays valid until the next DBGP_GetOverlayText or
+ * DBGP_RenderOverlay call on the overlay, whatever the producer publishes in
+ * the meantime.
+ *
+ * \param overlay The overlay
+ * \return the text of the most recent snapshot ("" before the first one), or
+ * NULL if overlay is NULL.
+ *
+ * \sa DBGP_RenderOverlay
+ */
+const char* DBGP_GetOverlayText(DBGP_Overlay* overlay);
+
+/**
+ * \fn bool DBGP_RenderOverlay(DBGP_Overlay* overlay, DBGP_Font* font,
+ * SDL_Renderer* renderer, int x, int y, Uint8 colors)
+ * \brief Draws the most recent snapshot of an overlay, from the render thread.
+ *
+ * The snapshot is drawn with DBGP_ColorPrint.
+ *
+ * \param overlay The overlay
+ * \param font The font to draw with
+ * \param renderer The rendering context
+ * \param x The X coordinate of the text
+ * \param y The Y coordinate of the text
+ * \param colors The colors at the start of the text
+ * \return true on success or false on failure; call SDL_GetError() for more
+ * information.
+ *
+ * \sa DBGP_GetOverlayText
+ */
+bool DBGP_RenderOverlay(
+    DBGP_Overlay* overlay, DBGP_Font* font, SDL_Renderer* renderer, int x,
+    int y, Uint8 colors);
+
+#ifdef __cplusplus
+}
+#endif
+
 #endif // DBGP_DBGP_H
@@ -0,0 +1,225 @@
+/** \file SDL_DBGP.hpp */
+
+/**
+ * Optional C++17 helpers compiling string literals into the glyphs drawn by
+ * DBGP_RenderCompiled, so that static labels are neither decoded nor parsed
+ * at runtime:
+ *
+ * \code
+ * static constexpr auto label = DBGP::Compile("$1fFPS:$0f counter");
+ * DBGP::RenderCompiled(&font, renderer, 8, 8, label);
+ * \endcode
+ *
+ * Strings follow the rules of DBGP_ColorPrint. Invalid UTF-8, malformed
+ * escape codes (such as "$f", "$1g" or "$G1;") and codepoints without a glyph
+ * in the font are compile errors (with C++20, even if the result isn't
+ * assigned to a constexpr variable). Fonts are expected to map codepoint N to
+ * glyph N, as the UNSCII fonts do.
+ */
+
+#ifndef DBGP_DBGP_HPP
+#define DBGP_DBGP_HPP
+
+#include <cstddef>
+#include "SDL_DBGP.h"
+
+#if defined(__cpp_consteval)
+#define DBGP_CONSTEVAL consteval
+#else
+#define DBGP_CONSTEVAL constexpr
+#endif
+
+namespace DBGP {
+
+/**
+ * \struct CompiledText
+ * \brief The glyphs of a string compiled by DBGP::Compile.
+ *
+ * \sa DBGP::Compile
+ */
+template <std::size_t N> struct CompiledText {
+  DBGP_CompiledGlyph glyphs[N]; /**< the glyphs, nb_glyphs are used */
+  int nb_glyphs; /**< the number of glyphs of the string */
+};
+
+namespace detail {
+
+// Called while compiling a string to report an error: being not constexpr,
+// they stop the compilation, and their name shows in the diagnostic.
+inline void invalid_utf8_in_string() {}
+inline void malformed_color_escape_in_string() {}
+inline void malformed_escape_in_string() {}
+inline void pixel_escape_in_compiled_string() {}
+inline void codepoint_not_in_font() {}
+inline void string_longer_than_capacity() {}
+
+constexpr int get_hex_value(char c) {
+  return c >= '0' && c <= '9'   ? c - '0'
+         : c >= 'a' && c <= 'f' ? c - 'a' + 10
+         : c >= 'A' && c <= 'F' ? c - 'A' + 10
+                                : -1;
+}
+
+// Parses the decimal number of an escape code starting at str[*i], and the
+// separator following it, moving *i after them.
+constexpr int parse_int(
+    const char* str, std::size_t len, std::size_t* i, char separator) {
+  int value = 0;
+  const std::size_t start = *i;
+  for (; *i < len && str[*i] >= '0' && str[*i] <= '9'; (*i)++) {
+    value = value * 10 + (str[*i] - '0');
+    if (value > 0xffff) {
+      malformed_escape_in_string();
+    }
+  }
+  if (*i == start || *i >= len || str[*i] != separator) {
+    malformed_escape_in_string();
+  }
+  (*i)++;
+  return value;
+}
+
+// Decodes the UTF-8 sequence starting at str[*i], moving *i after it.
+constexpr Uint32 step_utf8(const char* str, std::size_t len, std::size_t* i) {
+  const Uint8 lead = static_cast<Uint8>(str[(*i)++]);
+  if (lead < 0x80) {
+    return lead;
+  }
+  const int nb_bytes = (lead & 0xe0) == 0xc0   ? 1
+                       : (lead & 0xf0) == 0xe0 ? 2
+                       : (lead & 0xf8) == 0xf0 ? 3
+                                               : 0;
+  Uint32 cp = lead & (0x3f >> nb_bytes);
+  for (int n = 0; n < nb_bytes; n++) {
+    const Uint8 byte = *i < len ? static_cast<Uint8>(str[*i]) : 0;
+    if ((byte & 0xc0) != 0x80) {
+      invalid_utf8_in_string();
+    }
+    cp = cp << 6 | (byte & 0x3f);
+    (*i)++;
+  }
+  constexpr Uint32 min_values[4] = {0, 0x80, 0x800, 0x10000};
+  if (nb_bytes == 0 || cp < min_values[nb_bytes] || cp > 0x10ffff ||
+      (cp >= 0xd800 && cp <= 0xdfff)) {
+    invalid_utf8_in_string();
+  }
+  return cp;
+}
+
+} // namespace detail
+
+/**
+ * \brief Compiles a string literal into the glyphs drawn by
+ * DBGP_RenderCompiled, at compile time.
+ *
+ * Glyphs are laid out as DBGP_ColorPrint would: newlines start a new line,
+ * tabs move to the next tab stop, and escape codes change the colors of the
+ * following glyphs, move to a column and row (`$G<col>,<row>;`) or repeat a
+ * glyph (`$*<n>;<c>`). Pixel positioning escape codes (`$P` and `$M`) can't be
+ * compiled, and a "$" that doesn't start an escape code is drawn as is. Each
+ * glyph takes one cell: text with wide codepoints (see DBGP_GetCodepointWidth)
+ * should be drawn with DBGP_ColorPrint.
+ *
+ * \tparam NbGlyphs The number of glyphs of the font the string is drawn with
+ * (256 for the UNSCII fonts)
+ * \tparam Capacity The maximum number of glyphs of the string, only needed
+ * when repeat escape codes make it longer than the literal (0 for the size of
+ * the literal)
+ * \param str The text to compile. Must be UTF-8 encoded.
+ * \param colors The colors at the start of the text
+ * \return the compiled glyphs
+ *
+ * \sa DBGP::RenderCompiled
+ */
+template <unsigned int NbGlyphs = 256, std::size_t Capacity = 0, std::size_t N>
+DBGP_CONSTEVAL CompiledText<Capacity != 0 ? Capacity : N> Compile(
+    const char (&str)[N], Uint8 colors = DBGP_DEFAULT_COLORS) {
+  constexpr std::size_t capacity = Capacity != 0 ? Capacity : N;
+  CompiledText<capacity> text{};
+  const std::size_t len = N - 1;
+  std::size_t i = 0;
+  int column = 0;
+  int line = 0;
+  while (i < len && str[i] != '\0') {
+    int count = 1;
+    if (DBGP_ENABLE_ESCAPING && str[i] == DBGP_ESCAPE_CHAR && i + 1 < len) {
+      const char type = str[i + 1];
+      if (detail::get_hex_value(type) >= 0) {
+        if (i + 2 >= len || detail::get_hex_value(str[i + 2]) < 0) {
+          detail::malformed_color_escape_in_string();
+        }
+        colors = static_cast<Uint8>(
+            detail::get_hex_value(type) << 4 |
+            detail::get_hex_value(str[i + 2]));
+        i += 3;
+        continue;
+      }
+      if (type == 'P' || type == 'M') {
+        detail::pixel_escape_in_compiled_string();
+      }
+      if (type == 'G') {
+        i += 2;
+        column = detail::parse_int(str, len, &i, ',');
+        line = detail::parse_int(str, len, &i, ';');
+        continue;
+      }
+      if (type == '*') {
+        i += 2;
+        count = detail::parse_int(str, len, &i, ';');
+        if (i >= len) {
+          detail::malformed_escape_in_string();
+        }
+      }
+    }
+
+    const Uint32 cp = detail::step_utf8(str, len, &i);
+    for (int n = 0; n < count; n++) {
+      if (cp == '\n') {
+        line++;
+        column = 0;
+      } else if (cp == '\t' && DBGP_ENABLE_ESCAPING) {
+        column = (column / DBGP_TAB_WIDTH + 1) * DBGP_TAB_WIDTH;
+      } else {
+        if (cp >= NbGlyphs) {
+          detail::codepoint_not_in_font();
+        }
+        if (static_cast<std::size_t>(text.nb_glyphs) == capacity) {
+          detail::string_longer_than_capacity();
+        }
+        DBGP_CompiledGlyph& glyph = text.glyphs[text.nb_glyphs++];
+        glyph.glyph = cp;
+        glyph.column = static_cast<Uint16>(column++);
+        glyph.line = static_cast<Uint16>(line);
+        glyph.colors = colors;
+      }
+    }
+  }
+  return text;
+}
+
+/**
+ * \brief Draws a string compiled by DBGP::Compile.
+ *
+ * \param font The font to draw with
+ * \param renderer The rendering context
+ * \param x The X coordinate of the text
+ * \param y The Y coordinate of the text
+ * \param text The compiled text
+ * \return true on success or false on failure; call SDL_GetError() for more
+ * information.
+ *
+ * \sa DBGP_RenderCompiled
+ */
+template <std::size_t N>
+inline bool RenderCompiled(
+    DBGP_Font* font, SDL_Renderer* renderer, int x, int y,
+    const CompiledText<N>& text) {
+  return DBGP_RenderCompiled(
+      font, renderer, x, y, text.glyphs, text.nb_glyphs);
+}
+
+} // namespace DBGP
+
+#undef DBGP_CONSTEVAL
+
+#endif // DBGP_DBGP_HPP
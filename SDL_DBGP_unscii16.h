@@ -1,6 +1,11 @@
 /*
  * Raw data to use with SDL_DBGP. Font is
  * [UNSCII-16](https://github.com/viznut/unscii), in the public domain.
+ *
+ * 2298 bytes (with the final NUL), compressed from 4096 bytes.
+ *
+ * Define DBGP_UNSCII16_IMPLEMENTATION in exactly one source file before
+ * including this header.
  */
 
 #ifndef DBGP_UNSCII16_H
@@ -9,348 +14,147 @@
 static const unsigned int DBGP_UNSCII16_WIDTH = 8;
 static const unsigned int DBGP_UNSCII16_HEIGHT = 16;
 static const unsigned int DBGP_UNSCII16_NB_GLYPHS = 256;
-static const unsigned char DBGP_UNSCII16[256 * 16] = {
-    0x0,  0x0,  0x0,  0x0,  0x0,  0x0,  0x0,  0x0,  0x0,  0x0,  0x0,  0x0,
-    0x0,  0x0,  0x0,  0x0,  0xe0, 0xe0, 0x80, 0x80, 0xea, 0xea, 0x2a, 0x2a,
-    0xee, 0xee, 0xa,  0xa,  0xa,  0xa,  0x0,  0x0,  0xe0, 0xe0, 0x80, 0x80,
-    0xea, 0xea, 0x2a, 0x2a, 0xe4, 0xe4, 0xa,  0xa,  0xa,  0xa,  0x0,  0x0,
-    0xe0, 0xe0, 0x80, 0x80, 0xca, 0xca, 0x8a, 0x8a, 0xe4, 0xe4, 0xa,  0xa,
-    0xa,  0xa,  0x0,  0x0,  0xe0, 0xe0, 0x80, 0x80, 0xce, 0xce, 0x84, 0x84,
-    0xe4, 0xe4, 0x4,  0x4,  0x4,  0x4,  0x0,  0x0,  0xe0, 0xe0, 0x80, 0x80,
-    0xce, 0xce, 0x8a, 0x8a, 0xea, 0xea, 0xe,  0xe,  0x4,  0x4,  0x0,  0x0,
-    0xe0, 0xe0, 0xa0, 0xa0, 0xea, 0xea, 0xaa, 0xaa, 0xac, 0xac, 0xa,  0xa,
-    0xa,  0xa,  0x0,  0x0,  0xc0, 0xc0, 0xa0, 0xa0, 0xc8, 0xc8, 0xa8, 0xa8,
-    0xc8, 0xc8, 0x8,  0x8,  0xe,  0xe,  0x0,  0x0,  0xc0, 0xc0, 0xa0, 0xa0,
-    0xce, 0xce, 0xa8, 0xa8, 0xce, 0xce, 0x2,  0x2,  0xe,  0xe,  0x0,  0x0,
-    0xa0, 0xa0, 0xa0, 0xa0, 0xee, 0xee, 0xa4, 0xa4, 0xa4, 0xa4, 0x4,  0x4,
-    0x4,  0x4,  0x0,  0x0,  0x80, 0x80, 0x80, 0x80, 0x8e, 0x8e, 0x88, 0x88,
-    0xec, 0xec, 0x8,  0x8,  0x8,  0x8,  0x0,  0x0,  0xa0, 0xa0, 0xa0, 0xa0,
-    0xae, 0xae, 0xa4, 0xa4, 0x44, 0x44, 0x4,  0x4,  0x4,  0x4,  0x0,  0x0,
-    0xe0, 0xe0, 0x80, 0x80, 0xce, 0xce, 0x88, 0x88, 0x8c, 0x8c, 0x8,  0x8,
-    0x8,  0x8,  0x0,  0x0,  0xe0, 0xe0, 0x80, 0x80, 0x8e, 0x8e, 0x8a, 0x8a,
-    0xee, 0xee, 0xc,  0xc,  0xa,  0xa,  0x0,  0x0,  0xe0, 0xe0, 0x80, 0x80,
-    0xee, 0xee, 0x2a, 0x2a, 0xea, 0xea, 0xa,  0xa,  0xe,  0xe,  0x0,  0x0,
-    0xe0, 0xe0, 0x80, 0x80, 0xee, 0xee, 0x24, 0x24, 0xe4, 0xe4, 0x4,  0x4,
-    0xe,  0xe,  0x0,  0x0,  0xc0, 0xc0, 0xa0, 0xa0, 0xa8, 0xa8, 0xa8, 0xa8,
-    0xc8, 0xc8, 0x8,  0x8,  0xe,  0xe,  0x0,  0x0,  0xc0, 0xc0, 0xa0, 0xa0,
-    0xa4, 0xa4, 0xac, 0xac, 0xc4, 0xc4, 0x4,  0x4,  0xe,  0xe,  0x0,  0x0,
-    0xc0, 0xc0, 0xa0, 0xa0, 0xae, 0xae, 0xa2, 0xa2, 0xce, 0xce, 0x8,  0x8,
-    0xe,  0xe,  0x0,  0x0,  0xc0, 0xc0, 0xa0, 0xa0, 0xae, 0xae, 0xa2, 0xa2,
-    0xc6, 0xc6, 0x2,  0x2,  0xe,  0xe,  0x0,  0x0,  0xc0, 0xc0, 0xa0, 0xa0,
-    0xaa, 0xaa, 0xaa, 0xaa, 0xce, 0xce, 0x2,  0x2,  0x2,  0x2,  0x0,  0x0,
-    0xe0, 0xe0, 0xa0, 0xa0, 0xaa, 0xaa, 0xaa, 0xaa, 0xac, 0xac, 0xa,  0xa,
-    0xa,  0xa,  0x0,  0x0,  0xe0, 0xe0, 0x80, 0x80, 0xea, 0xea, 0x2a, 0x2a,
-    0xee, 0xee, 0x4,  0x4,  0x4,  0x4,  0x0,  0x0,  0xe0, 0xe0, 0x80, 0x80,
-    0xcc, 0xcc, 0x8a, 0x8a, 0xec, 0xec, 0xa,  0xa,  0xc,  0xc,  0x0,  0x0,
-    0xe0, 0xe0, 0x80, 0x80, 0x8e, 0x8e, 0x8a, 0x8a, 0xea, 0xea, 0xa,  0xa,
-    0xa,  0xa,  0x0,  0x0,  0xe0, 0xe0, 0x80, 0x80, 0xca, 0xca, 0x8e, 0x8e,
-    0xea, 0xea, 0xa,  0xa,  0xa,  0xa,  0x0,  0x0,  0x3c, 0x3c, 0x66, 0x66,
-    0x66, 0x66, 0x30, 0x30, 0x18, 0x18, 0x0,  0x0,  0x18, 0x18, 0x0,  0x0,
-    0xe0, 0xe0, 0x80, 0x80, 0xce, 0xce, 0x88, 0x88, 0xe8, 0xe8, 0x8,  0x8,
-    0xe,  0xe,  0x0,  0x0,  0xe0, 0xe0, 0x80, 0x80, 0xce, 0xce, 0x88, 0x88,
-    0x8e, 0x8e, 0x2,  0x2,  0xe,  0xe,  0x0,  0x0,  0xe0, 0xe0, 0x80, 0x80,
-    0xae, 0xae, 0xa8, 0xa8, 0xee, 0xee, 0x2,  0x2,  0xe,  0xe,  0x0,  0x0,
-    0xe0, 0xe0, 0xa0, 0xa0, 0xee, 0xee, 0xc8, 0xc8, 0xae, 0xae, 0x2,  0x2,
-    0xe,  0xe,  0x0,  0x0,  0xa0, 0xa0, 0xa0, 0xa0, 0xae, 0xae, 0xa8, 0xa8,
-    0xee, 0xee, 0x2,  0x2,  0xe,  0xe,  0x0,  0x0,  0x0,  0x0,  0x0,  0x0,
-    0x0,  0x0,  0x0,  0x0,  0x0,  0x0,  0x0,  0x0,  0x0,  0x0,  0x0,  0x0,
-    0x0,  0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x0,  0x0,  0x18,
-    0x18, 0x0,  0x0,  0x0,  0x0,  0x66, 0x66, 0x66, 0x0,  0x0,  0x0,  0x0,
-    0x0,  0x0,  0x0,  0x0,  0x0,  0x0,  0x0,  0x0,  0x0,  0x0,  0x6c, 0x6c,
-    0x6c, 0xfe, 0x6c, 0x6c, 0x6c, 0xfe, 0x6c, 0x6c, 0x6c, 0x0,  0x0,  0x0,
-    0x0,  0x18, 0x18, 0x3c, 0x66, 0x60, 0x30, 0x18, 0xc,  0x6,  0x66, 0x3c,
-    0x18, 0x18, 0x0,  0x0,  0x0,  0x0,  0x6,  0xc6, 0xcc, 0xcc, 0x18, 0x18,
-    0x30, 0x30, 0x66, 0x66, 0xc6, 0xc0, 0x0,  0x0,  0x0,  0x0,  0x38, 0x6c,
-    0x6c, 0x38, 0x30, 0x7a, 0xde, 0xcc, 0xcc, 0xcc, 0x76, 0x0,  0x0,  0x0,
-    0x0,  0x18, 0x18, 0x18, 0x30, 0x0,  0x0,  0x0,  0x0,  0x0,  0x0,  0x0,
-    0x0,  0x0,  0x0,  0x0,  0x0,  0xc,  0x18, 0x18, 0x30, 0x30, 0x30, 0x30,
-    0x30, 0x30, 0x30, 0x18, 0x18, 0xc,  0x0,  0x0,  0x0,  0x30, 0x18, 0x18,
-    0xc,  0xc,  0xc,  0xc,  0xc,  0xc,  0xc,  0x18, 0x18, 0x30, 0x0,  0x0,
-    0x0,  0x0,  0x0,  0x0,  0x66, 0x66, 0x3c, 0xff, 0x3c, 0x66, 0x66, 0x0,
-    0x0,  0x0,  0x0,  0x0,  0x0,  0x0,  0x0,  0x0,  0x18, 0x18, 0x18, 0x7e,
-    0x18, 0x18, 0x18, 0x0,  0x0,  0x0,  0x0,  0x0,  0x0,  0x0,  0x0,  0x0,
-    0x0,  0x0,  0x0,  0x0,  0x0,  0x0,  0x38, 0x18, 0x18, 0x30, 0x60, 0x0,
-    0x0,  0x0,  0x0,  0x0,  0x0,  0x0,  0x0,  0x7e, 0x0,  0x0,  0x0,  0x0,
-    0x0,  0x0,  0x0,  0x0,  0x0,  0x0,  0x0,  0x0,  0x0,  0x0,  0x0,  0x0,
-    0x0,  0x0,  0x18, 0x18, 0x18, 0x0,  0x0,  0x0,  0x3,  0x3,  0x6,  0x6,
-    0xc,  0xc,  0x18, 0x18, 0x30, 0x30, 0x60, 0x60, 0xc0, 0xc0, 0x0,  0x0,
-    0x0,  0x0,  0x38, 0x6c, 0xc6, 0xc6, 0xce, 0xd6, 0xe6, 0xc6, 0xc6, 0x6c,
-    0x38, 0x0,  0x0,  0x0,  0x0,  0x0,  0x18, 0x38, 0x78, 0x18, 0x18, 0x18,
-    0x18, 0x18, 0x18, 0x18, 0x7e, 0x0,  0x0,  0x0,  0x0,  0x0,  0x3c, 0x66,
-    0x66, 0x6,  0x6,  0xc,  0x18, 0x30, 0x60, 0x60, 0x7e, 0x0,  0x0,  0x0,
-    0x0,  0x0,  0x3c, 0x66, 0x66, 0x6,  0x6,  0x1c, 0x6,  0x6,  0x66, 0x66,
-    0x3c, 0x0,  0x0,  0x0,  0x0,  0x0,  0xc,  0x1c, 0x3c, 0x6c, 0xcc, 0xcc,
-    0xfe, 0xc,  0xc,  0xc,  0xc,  0x0,  0x0,  0x0,  0x0,  0x0,  0x7e, 0x60,
-    0x60, 0x60, 0x7c, 0x6,  0x6,  0x6,  0x66, 0x66, 0x3c, 0x0,  0x0,  0x0,
-    0x0,  0x0,  0x1c, 0x30, 0x60, 0x60, 0x7c, 0x66, 0x66, 0x66, 0x66, 0x66,
-    0x3c, 0x0,  0x0,  0x0,  0x0,  0x0,  0x7e, 0x6,  0x6,  0x6,  0xc,  0xc,
-    0x18, 0x18, 0x18, 0x18, 0x18, 0x0,  0x0,  0x0,  0x0,  0x0,  0x3c, 0x66,
-    0x66, 0x66, 0x76, 0x3c, 0x6e, 0x66, 0x66, 0x66, 0x3c, 0x0,  0x0,  0x0,
-    0x0,  0x0,  0x3c, 0x66, 0x66, 0x66, 0x66, 0x3e, 0x6,  0x6,  0x6,  0xc,
-    0x38, 0x0,  0x0,  0x0,  0x0,  0x0,  0x0,  0x18, 0x18, 0x18, 0x0,  0x0,
-    0x0,  0x0,  0x18, 0x18, 0x18, 0x0,  0x0,  0x0,  0x0,  0x0,  0x0,  0x18,
-    0x18, 0x18, 0x0,  0x0,  0x0,  0x0,  0x38, 0x18, 0x18, 0x30, 0x60, 0x0,
-    0x0,  0x0,  0x0,  0x6,  0xc,  0x18, 0x30, 0x60, 0x30, 0x18, 0xc,  0x6,
-    0x0,  0x0,  0x0,  0x0,  0x0,  0x0,  0x0,  0x0,  0x0,  0x7e, 0x0,  0x0,
-    0x0,  0x7e, 0x0,  0x0,  0x0,  0x0,  0x0,  0x0,  0x0,  0x0,  0x0,  0x60,
-    0x30, 0x18, 0xc,  0x6,  0xc,  0x18, 0x30, 0x60, 0x0,  0x0,  0x0,  0x0,
-    0x0,  0x3c, 0x66, 0x66, 0x6,  0xc,  0x18, 0x18, 0x18, 0x0,  0x0,  0x18,
-    0x18, 0x0,  0x0,  0x0,  0x0,  0x0,  0x7c, 0xc6, 0xc6, 0xc6, 0xde, 0xde,
-    0xde, 0xdc, 0xc0, 0xc0, 0x7c, 0x0,  0x0,  0x0,  0x0,  0x0,  0x18, 0x3c,
-    0x66, 0x66, 0x66, 0x7e, 0x66, 0x66, 0x66, 0x66, 0x66, 0x0,  0x0,  0x0,
-    0x0,  0x0,  0x7c, 0x66, 0x66, 0x66, 0x6c, 0x78, 0x6c, 0x66, 0x66, 0x66,
-    0x7c, 0x0,  0x0,  0x0,  0x0,  0x0,  0x3c, 0x66, 0x66, 0x60, 0x60, 0x60,
-    0x60, 0x60, 0x66, 0x66, 0x3c, 0x0,  0x0,  0x0,  0x0,  0x0,  0x78, 0x6c,
-    0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x6c, 0x78, 0x0,  0x0,  0x0,
-    0x0,  0x0,  0x7e, 0x60, 0x60, 0x60, 0x60, 0x7c, 0x60, 0x60, 0x60, 0x60,
-    0x7e, 0x0,  0x0,  0x0,  0x0,  0x0,  0x7e, 0x60, 0x60, 0x60, 0x7c, 0x60,
-    0x60, 0x60, 0x60, 0x60, 0x60, 0x0,  0x0,  0x0,  0x0,  0x0,  0x3c, 0x66,
-    0x66, 0x60, 0x60, 0x6e, 0x66, 0x66, 0x66, 0x66, 0x3e, 0x0,  0x0,  0x0,
-    0x0,  0x0,  0x66, 0x66, 0x66, 0x66, 0x66, 0x7e, 0x66, 0x66, 0x66, 0x66,
-    0x66, 0x0,  0x0,  0x0,  0x0,  0x0,  0x7e, 0x18, 0x18, 0x18, 0x18, 0x18,
-    0x18, 0x18, 0x18, 0x18, 0x7e, 0x0,  0x0,  0x0,  0x0,  0x0,  0x6,  0x6,
-    0x6,  0x6,  0x6,  0x6,  0x6,  0x6,  0x66, 0x66, 0x3c, 0x0,  0x0,  0x0,
-    0x0,  0x0,  0xc6, 0xc6, 0xcc, 0xcc, 0xd8, 0xf0, 0xd8, 0xcc, 0xcc, 0xc6,
-    0xc6, 0x0,  0x0,  0x0,  0x0,  0x0,  0x60, 0x60, 0x60, 0x60, 0x60, 0x60,
-    0x60, 0x60, 0x60, 0x60, 0x7e, 0x0,  0x0,  0x0,  0x0,  0x0,  0xc6, 0xee,
-    0xee, 0xfe, 0xd6, 0xd6, 0xc6, 0xc6, 0xc6, 0xc6, 0xc6, 0x0,  0x0,  0x0,
-    0x0,  0x0,  0xc6, 0xc6, 0xe6, 0xe6, 0xf6, 0xfe, 0xde, 0xce, 0xce, 0xc6,
-    0xc6, 0x0,  0x0,  0x0,  0x0,  0x0,  0x3c, 0x66, 0x66, 0x66, 0x66, 0x66,
-    0x66, 0x66, 0x66, 0x66, 0x3c, 0x0,  0x0,  0x0,  0x0,  0x0,  0x7c, 0x66,
-    0x66, 0x66, 0x66, 0x7c, 0x60, 0x60, 0x60, 0x60, 0x60, 0x0,  0x0,  0x0,
-    0x0,  0x0,  0x3c, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66,
-    0x3c, 0xc,  0x6,  0x0,  0x0,  0x0,  0x7c, 0x66, 0x66, 0x66, 0x66, 0x7c,
-    0x6c, 0x66, 0x66, 0x66, 0x66, 0x0,  0x0,  0x0,  0x0,  0x0,  0x3c, 0x66,
-    0x66, 0x60, 0x30, 0x18, 0xc,  0x6,  0x66, 0x66, 0x3c, 0x0,  0x0,  0x0,
-    0x0,  0x0,  0x7e, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18,
-    0x18, 0x0,  0x0,  0x0,  0x0,  0x0,  0x66, 0x66, 0x66, 0x66, 0x66, 0x66,
-    0x66, 0x66, 0x66, 0x66, 0x3c, 0x0,  0x0,  0x0,  0x0,  0x0,  0x66, 0x66,
-    0x66, 0x66, 0x66, 0x66, 0x66, 0x3c, 0x3c, 0x18, 0x18, 0x0,  0x0,  0x0,
-    0x0,  0x0,  0xc6, 0xc6, 0xc6, 0xc6, 0xc6, 0xd6, 0xd6, 0xfe, 0xee, 0xee,
-    0xc6, 0x0,  0x0,  0x0,  0x0,  0x0,  0xc3, 0xc3, 0x66, 0x3c, 0x18, 0x18,
-    0x18, 0x3c, 0x66, 0xc3, 0xc3, 0x0,  0x0,  0x0,  0x0,  0x0,  0xc3, 0xc3,
-    0x66, 0x66, 0x3c, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x0,  0x0,  0x0,
-    0x0,  0x0,  0x7e, 0x6,  0x6,  0xc,  0xc,  0x18, 0x30, 0x30, 0x60, 0x60,
-    0x7e, 0x0,  0x0,  0x0,  0x0,  0x3c, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30,
-    0x30, 0x30, 0x30, 0x30, 0x30, 0x3c, 0x0,  0x0,  0xc0, 0xc0, 0x60, 0x60,
-    0x30, 0x30, 0x18, 0x18, 0xc,  0xc,  0x6,  0x6,  0x3,  0x3,  0x0,  0x0,
-    0x0,  0x3c, 0xc,  0xc,  0xc,  0xc,  0xc,  0xc,  0xc,  0xc,  0xc,  0xc,
-    0xc,  0x3c, 0x0,  0x0,  0x0,  0x10, 0x38, 0x6c, 0x6c, 0xc6, 0xc6, 0x0,
-    0x0,  0x0,  0x0,  0x0,  0x0,  0x0,  0x0,  0x0,  0x0,  0x0,  0x0,  0x0,
-    0x0,  0x0,  0x0,  0x0,  0x0,  0x0,  0x0,  0x0,  0x0,  0x0,  0x0,  0xff,
-    0x0,  0x18, 0x18, 0xc,  0x6,  0x0,  0x0,  0x0,  0x0,  0x0,  0x0,  0x0,
-    0x0,  0x0,  0x0,  0x0,  0x0,  0x0,  0x0,  0x0,  0x0,  0x0,  0x3c, 0x6,
-    0x3e, 0x66, 0x66, 0x66, 0x3e, 0x0,  0x0,  0x0,  0x0,  0x0,  0x60, 0x60,
-    0x60, 0x60, 0x7c, 0x66, 0x66, 0x66, 0x66, 0x66, 0x7c, 0x0,  0x0,  0x0,
-    0x0,  0x0,  0x0,  0x0,  0x0,  0x0,  0x3c, 0x66, 0x60, 0x60, 0x60, 0x66,
-    0x3c, 0x0,  0x0,  0x0,  0x0,  0x0,  0x6,  0x6,  0x6,  0x6,  0x3e, 0x66,
-    0x66, 0x66, 0x66, 0x66, 0x3e, 0x0,  0x0,  0x0,  0x0,  0x0,  0x0,  0x0,
-    0x0,  0x0,  0x3c, 0x66, 0x66, 0x7e, 0x60, 0x60, 0x3c, 0x0,  0x0,  0x0,
-    0x0,  0x0,  0x1e, 0x30, 0x30, 0x30, 0x7e, 0x30, 0x30, 0x30, 0x30, 0x30,
-    0x30, 0x0,  0x0,  0x0,  0x0,  0x0,  0x0,  0x0,  0x0,  0x0,  0x3e, 0x66,
-    0x66, 0x66, 0x66, 0x66, 0x3e, 0x6,  0x6,  0x7c, 0x0,  0x0,  0x60, 0x60,
-    0x60, 0x60, 0x7c, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x0,  0x0,  0x0,
-    0x0,  0x0,  0x18, 0x18, 0x0,  0x0,  0x78, 0x18, 0x18, 0x18, 0x18, 0x18,
-    0x1e, 0x0,  0x0,  0x0,  0x0,  0x0,  0xc,  0xc,  0x0,  0x0,  0xc,  0xc,
-    0xc,  0xc,  0xc,  0xc,  0xc,  0xc,  0xc,  0x78, 0x0,  0x0,  0x60, 0x60,
-    0x60, 0x60, 0x66, 0x66, 0x6c, 0x78, 0x6c, 0x66, 0x66, 0x0,  0x0,  0x0,
-    0x0,  0x0,  0x78, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18,
-    0x1e, 0x0,  0x0,  0x0,  0x0,  0x0,  0x0,  0x0,  0x0,  0x0,  0xcc, 0xfe,
-    0xd6, 0xd6, 0xd6, 0xd6, 0xc6, 0x0,  0x0,  0x0,  0x0,  0x0,  0x0,  0x0,
-    0x0,  0x0,  0x7c, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x0,  0x0,  0x0,
-    0x0,  0x0,  0x0,  0x0,  0x0,  0x0,  0x3c, 0x66, 0x66, 0x66, 0x66, 0x66,
-    0x3c, 0x0,  0x0,  0x0,  0x0,  0x0,  0x0,  0x0,  0x0,  0x0,  0x7c, 0x66,
-    0x66, 0x66, 0x66, 0x66, 0x7c, 0x60, 0x60, 0x60, 0x0,  0x0,  0x0,  0x0,
-    0x0,  0x0,  0x3e, 0x66, 0x66, 0x66, 0x66, 0x66, 0x3e, 0x6,  0x6,  0x6,
-    0x0,  0x0,  0x0,  0x0,  0x0,  0x0,  0x7c, 0x66, 0x66, 0x60, 0x60, 0x60,
-    0x60, 0x0,  0x0,  0x0,  0x0,  0x0,  0x0,  0x0,  0x0,  0x0,  0x3e, 0x60,
-    0x60, 0x3c, 0x6,  0x6,  0x7c, 0x0,  0x0,  0x0,  0x0,  0x0,  0x0,  0x30,
-    0x30, 0x30, 0x7e, 0x30, 0x30, 0x30, 0x30, 0x30, 0x1e, 0x0,  0x0,  0x0,
-    0x0,  0x0,  0x0,  0x0,  0x0,  0x0,  0x66, 0x66, 0x66, 0x66, 0x66, 0x66,
-    0x3e, 0x0,  0x0,  0x0,  0x0,  0x0,  0x0,  0x0,  0x0,  0x0,  0x66, 0x66,
-    0x66, 0x66, 0x66, 0x3c, 0x18, 0x0,  0x0,  0x0,  0x0,  0x0,  0x0,  0x0,
-    0x0,  0x0,  0xc6, 0xc6, 0xd6, 0xd6, 0xd6, 0x7c, 0x6c, 0x0,  0x0,  0x0,
-    0x0,  0x0,  0x0,  0x0,  0x0,  0x0,  0xc6, 0xc6, 0x6c, 0x38, 0x6c, 0xc6,
-    0xc6, 0x0,  0x0,  0x0,  0x0,  0x0,  0x0,  0x0,  0x0,  0x0,  0x66, 0x66,
-    0x66, 0x66, 0x66, 0x66, 0x3e, 0x6,  0x6,  0x3c, 0x0,  0x0,  0x0,  0x0,
-    0x0,  0x0,  0x7e, 0x6,  0xc,  0x18, 0x30, 0x60, 0x7e, 0x0,  0x0,  0x0,
-    0x0,  0xe,  0x18, 0x18, 0x18, 0x18, 0x18, 0xf0, 0x18, 0x18, 0x18, 0x18,
-    0x18, 0xe,  0x0,  0x0,  0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18,
-    0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x0,  0x0,  0x0,  0xe0, 0x30, 0x30,
-    0x30, 0x30, 0x30, 0x1e, 0x30, 0x30, 0x30, 0x30, 0x30, 0xe0, 0x0,  0x0,
-    0x0,  0x72, 0xd6, 0x9c, 0x0,  0x0,  0x0,  0x0,  0x0,  0x0,  0x0,  0x0,
-    0x0,  0x0,  0x0,  0x0,  0xc0, 0xc0, 0xa0, 0xa0, 0xae, 0xae, 0xa4, 0xa4,
-    0xc4, 0xc4, 0x4,  0x4,  0x4,  0x4,  0x0,  0x0,  0xe0, 0xe0, 0xa0, 0xa0,
-    0xee, 0xee, 0xaa, 0xaa, 0xea, 0xea, 0xa,  0xa,  0xe,  0xe,  0x0,  0x0,
-    0xe0, 0xe0, 0xa0, 0xa0, 0xe4, 0xe4, 0xac, 0xac, 0xe4, 0xe4, 0x4,  0x4,
-    0xe,  0xe,  0x0,  0x0,  0xe0, 0xe0, 0xa0, 0xa0, 0xee, 0xee, 0xa2, 0xa2,
-    0xee, 0xee, 0x8,  0x8,  0xe,  0xe,  0x0,  0x0,  0xe0, 0xe0, 0xa0, 0xa0,
-    0xee, 0xee, 0xa2, 0xa2, 0xee, 0xee, 0x2,  0x2,  0xe,  0xe,  0x0,  0x0,
-    0xe0, 0xe0, 0x40, 0x40, 0x4e, 0x4e, 0x4a, 0x4a, 0xea, 0xea, 0xa,  0xa,
-    0xa,  0xa,  0x0,  0x0,  0xe0, 0xe0, 0xa0, 0xa0, 0xa8, 0xa8, 0xa8, 0xa8,
-    0xa8, 0xa8, 0x8,  0x8,  0xe,  0xe,  0x0,  0x0,  0xe0, 0xe0, 0x80, 0x80,
-    0xee, 0xee, 0x28, 0x28, 0xee, 0xee, 0x2,  0x2,  0xe,  0xe,  0x0,  0x0,
-    0xe0, 0xe0, 0x80, 0x80, 0xce, 0xce, 0x88, 0x88, 0xee, 0xee, 0x2,  0x2,
-    0xe,  0xe,  0x0,  0x0,  0xa0, 0xa0, 0xa0, 0xa0, 0xee, 0xee, 0xa8, 0xa8,
-    0xae, 0xae, 0x2,  0x2,  0xe,  0xe,  0x0,  0x0,  0xa0, 0xa0, 0xa0, 0xa0,
-    0xe2, 0xe2, 0xa2, 0xa2, 0xa2, 0xa2, 0xa,  0xa,  0xe,  0xe,  0x0,  0x0,
-    0xa0, 0xa0, 0xa0, 0xa0, 0xae, 0xae, 0xa8, 0xa8, 0x4e, 0x4e, 0x2,  0x2,
-    0xe,  0xe,  0x0,  0x0,  0xe0, 0xe0, 0xa0, 0xa0, 0xec, 0xec, 0x8a, 0x8a,
-    0x8a, 0x8a, 0xa,  0xa,  0xc,  0xc,  0x0,  0x0,  0xe0, 0xe0, 0xa0, 0xa0,
-    0xea, 0xea, 0x8a, 0x8a, 0x8a, 0x8a, 0xa,  0xa,  0xe,  0xe,  0x0,  0x0,
-    0xc0, 0xc0, 0xa0, 0xa0, 0xce, 0xce, 0xa4, 0xa4, 0xa4, 0xa4, 0x4,  0x4,
-    0xe,  0xe,  0x0,  0x0,  0xe0, 0xe0, 0x80, 0x80, 0xee, 0xee, 0x22, 0x22,
-    0xee, 0xee, 0x8,  0x8,  0xe,  0xe,  0x0,  0x0,  0xe0, 0xe0, 0x80, 0x80,
-    0xee, 0xee, 0x22, 0x22, 0xe6, 0xe6, 0x2,  0x2,  0xe,  0xe,  0x0,  0x0,
-    0xc0, 0xc0, 0xa0, 0xa0, 0xae, 0xae, 0xa8, 0xa8, 0xc8, 0xc8, 0x8,  0x8,
-    0xe,  0xe,  0x0,  0x0,  0xe0, 0xe0, 0xa0, 0xa0, 0xe4, 0xe4, 0x8c, 0x8c,
-    0x84, 0x84, 0x4,  0x4,  0xe,  0xe,  0x0,  0x0,  0xe0, 0xe0, 0xa0, 0xa0,
-    0xee, 0xee, 0x82, 0x82, 0x8e, 0x8e, 0x8,  0x8,  0xe,  0xe,  0x0,  0x0,
-    0xe0, 0xe0, 0x80, 0x80, 0xee, 0xee, 0x28, 0x28, 0xec, 0xec, 0x8,  0x8,
-    0xe,  0xe,  0x0,  0x0,  0xe0, 0xe0, 0x80, 0x80, 0x8e, 0x8e, 0x88, 0x88,
-    0xe8, 0xe8, 0x8,  0x8,  0xe,  0xe,  0x0,  0x0,  0xa0, 0xa0, 0xe0, 0xe0,
-    0xea, 0xea, 0xaa, 0xaa, 0xae, 0xae, 0xe,  0xe,  0xa,  0xa,  0x0,  0x0,
-    0xe0, 0xe0, 0x80, 0x80, 0xee, 0xee, 0x2a, 0x2a, 0xee, 0xee, 0x8,  0x8,
-    0x8,  0x8,  0x0,  0x0,  0xe0, 0xe0, 0x80, 0x80, 0xce, 0xce, 0x8a, 0x8a,
-    0xee, 0xee, 0x8,  0x8,  0x8,  0x8,  0x0,  0x0,  0xe0, 0xe0, 0xa0, 0xa0,
-    0xee, 0xee, 0x2a, 0x2a, 0xee, 0xee, 0xa,  0xa,  0xe,  0xe,  0x0,  0x0,
-    0xe0, 0xe0, 0xa0, 0xa0, 0xee, 0xee, 0x2a, 0x2a, 0xee, 0xee, 0x2,  0x2,
-    0xe,  0xe,  0x0,  0x0,  0xe0, 0xe0, 0xa0, 0xa0, 0xee, 0xee, 0x2a, 0x2a,
-    0xee, 0xee, 0xa,  0xa,  0xa,  0xa,  0x0,  0x0,  0xe0, 0xe0, 0x80, 0x80,
-    0x8e, 0x8e, 0x88, 0x88, 0xee, 0xee, 0x2,  0x2,  0xe,  0xe,  0x0,  0x0,
-    0xe0, 0xe0, 0x80, 0x80, 0xee, 0xee, 0x24, 0x24, 0xe4, 0xe4, 0x4,  0x4,
-    0x4,  0x4,  0x0,  0x0,  0xe0, 0xe0, 0xa0, 0xa0, 0xae, 0xae, 0xa8, 0xa8,
-    0xee, 0xee, 0x2,  0x2,  0xe,  0xe,  0x0,  0x0,  0xe0, 0xe0, 0xa0, 0xa0,
-    0xea, 0xea, 0x8e, 0x8e, 0x8e, 0x8e, 0xa,  0xa,  0xa,  0xa,  0x0,  0x0,
-    0xe0, 0xe0, 0xa0, 0xa0, 0xee, 0xee, 0xaa, 0xaa, 0xae, 0xae, 0x8,  0x8,
-    0x8,  0x8,  0x0,  0x0,  0x0,  0x0,  0x0,  0x0,  0x0,  0x0,  0x0,  0x0,
-    0x0,  0x0,  0x0,  0x0,  0x0,  0x0,  0x0,  0x0,  0x0,  0x18, 0x18, 0x0,
-    0x0,  0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x0,  0x0,  0x0,
-    0x0,  0x18, 0x18, 0x18, 0x3c, 0x66, 0x60, 0x60, 0x66, 0x3c, 0x18, 0x18,
-    0x18, 0x0,  0x0,  0x0,  0x0,  0x0,  0x38, 0x6c, 0x6c, 0x60, 0x60, 0xf0,
-    0x60, 0x60, 0x66, 0x66, 0xfc, 0x0,  0x0,  0x0,  0x0,  0x0,  0x66, 0x3c,
-    0x66, 0x66, 0x66, 0x3c, 0x66, 0x0,  0x0,  0x0,  0x0,  0x0,  0x0,  0x0,
-    0x0,  0x0,  0xc3, 0xc3, 0x66, 0x66, 0x3c, 0x18, 0x7e, 0x18, 0x7e, 0x18,
-    0x18, 0x0,  0x0,  0x0,  0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x0,  0x0,
-    0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x0,  0x0,  0x0,  0x3c, 0x66, 0x60,
-    0x30, 0x38, 0x6c, 0x66, 0x36, 0x1c, 0xc,  0x6,  0x66, 0x3c, 0x0,  0x0,
-    0x66, 0x66, 0x0,  0x0,  0x0,  0x0,  0x0,  0x0,  0x0,  0x0,  0x0,  0x0,
-    0x0,  0x0,  0x0,  0x0,  0x0,  0x0,  0x3c, 0x42, 0x81, 0x9d, 0xb1, 0xb1,
-    0xb1, 0x9d, 0x81, 0x42, 0x3c, 0x0,  0x0,  0x0,  0x0,  0x3c, 0x6,  0x6,
-    0x3e, 0x66, 0x66, 0x3e, 0x0,  0x7e, 0x0,  0x0,  0x0,  0x0,  0x0,  0x0,
-    0x0,  0x0,  0x0,  0x0,  0x0,  0x33, 0x66, 0xcc, 0x66, 0x33, 0x0,  0x0,
-    0x0,  0x0,  0x0,  0x0,  0x0,  0x0,  0x0,  0x0,  0x0,  0x0,  0xfe, 0x6,
-    0x6,  0x6,  0x6,  0x0,  0x0,  0x0,  0x0,  0x0,  0x0,  0x0,  0x0,  0x0,
-    0x0,  0x0,  0x0,  0x3c, 0x0,  0x0,  0x0,  0x0,  0x0,  0x0,  0x0,  0x0,
-    0x0,  0x0,  0x3c, 0x42, 0x81, 0xb9, 0xa5, 0xb9, 0xa5, 0xa5, 0x81, 0x42,
-    0x3c, 0x0,  0x0,  0x0,  0x7e, 0x0,  0x0,  0x0,  0x0,  0x0,  0x0,  0x0,
-    0x0,  0x0,  0x0,  0x0,  0x0,  0x0,  0x0,  0x0,  0x0,  0x3c, 0x66, 0x66,
-    0x3c, 0x0,  0x0,  0x0,  0x0,  0x0,  0x0,  0x0,  0x0,  0x0,  0x0,  0x0,
-    0x0,  0x0,  0x0,  0x0,  0x18, 0x18, 0x18, 0x7e, 0x18, 0x18, 0x18, 0x0,
-    0x7e, 0x0,  0x0,  0x0,  0x0,  0x38, 0x6c, 0xc,  0x18, 0x30, 0x60, 0x7c,
-    0x0,  0x0,  0x0,  0x0,  0x0,  0x0,  0x0,  0x0,  0x0,  0x38, 0x6c, 0xc,
-    0x38, 0xc,  0x6c, 0x38, 0x0,  0x0,  0x0,  0x0,  0x0,  0x0,  0x0,  0x0,
-    0xc,  0xc,  0x18, 0x18, 0x30, 0x30, 0x0,  0x0,  0x0,  0x0,  0x0,  0x0,
-    0x0,  0x0,  0x0,  0x0,  0x0,  0x0,  0x0,  0x0,  0x0,  0x0,  0x66, 0x66,
-    0x66, 0x66, 0x66, 0x66, 0x7c, 0x60, 0x60, 0xc0, 0x0,  0x0,  0x3e, 0x7a,
-    0x7a, 0x7a, 0x7a, 0x3a, 0x1a, 0x1a, 0x1a, 0x1a, 0x1a, 0x0,  0x0,  0x0,
-    0x0,  0x0,  0x0,  0x0,  0x0,  0x0,  0x0,  0x18, 0x0,  0x0,  0x0,  0x0,
-    0x0,  0x0,  0x0,  0x0,  0x0,  0x0,  0x0,  0x0,  0x0,  0x0,  0x0,  0x0,
-    0x0,  0x0,  0x0,  0x0,  0x0,  0xc,  0x6,  0x1c, 0x0,  0x30, 0x70, 0x30,
-    0x30, 0x30, 0x30, 0x30, 0x0,  0x0,  0x0,  0x0,  0x0,  0x0,  0x0,  0x0,
-    0x0,  0x0,  0x0,  0x3c, 0x66, 0x66, 0x66, 0x3c, 0x0,  0x7e, 0x0,  0x0,
-    0x0,  0x0,  0x0,  0x0,  0x0,  0x0,  0x0,  0x0,  0x0,  0xcc, 0x66, 0x33,
-    0x66, 0xcc, 0x0,  0x0,  0x0,  0x0,  0x0,  0x0,  0x0,  0x40, 0xc6, 0x46,
-    0x4c, 0x4c, 0x18, 0x18, 0x30, 0x30, 0x62, 0x66, 0xca, 0xcf, 0x2,  0x0,
-    0x0,  0x40, 0xc6, 0x46, 0x4c, 0x4c, 0x18, 0x18, 0x30, 0x30, 0x6c, 0x62,
-    0xc4, 0xc8, 0xe,  0x0,  0x0,  0xc0, 0x26, 0x66, 0x2c, 0xcc, 0x18, 0x18,
-    0x30, 0x30, 0x62, 0x66, 0xca, 0xcf, 0x2,  0x0,  0x0,  0x18, 0x18, 0x0,
-    0x0,  0x18, 0x30, 0x30, 0x60, 0x60, 0x66, 0x66, 0x3c, 0x0,  0x0,  0x0,
-    0x30, 0x18, 0x0,  0x18, 0x3c, 0x66, 0x66, 0x66, 0x7e, 0x66, 0x66, 0x66,
-    0x66, 0x0,  0x0,  0x0,  0xc,  0x18, 0x0,  0x18, 0x3c, 0x66, 0x66, 0x66,
-    0x7e, 0x66, 0x66, 0x66, 0x66, 0x0,  0x0,  0x0,  0x18, 0x66, 0x0,  0x18,
-    0x3c, 0x66, 0x66, 0x66, 0x7e, 0x66, 0x66, 0x66, 0x66, 0x0,  0x0,  0x0,
-    0x76, 0xdc, 0x0,  0x18, 0x3c, 0x66, 0x66, 0x66, 0x7e, 0x66, 0x66, 0x66,
-    0x66, 0x0,  0x0,  0x0,  0x66, 0x66, 0x0,  0x18, 0x3c, 0x66, 0x66, 0x66,
-    0x7e, 0x66, 0x66, 0x66, 0x66, 0x0,  0x0,  0x0,  0x3c, 0x66, 0x3c, 0x0,
-    0x18, 0x3c, 0x66, 0x66, 0x7e, 0x66, 0x66, 0x66, 0x66, 0x0,  0x0,  0x0,
-    0x0,  0x0,  0x3f, 0x7c, 0xfc, 0xcc, 0xcc, 0xfe, 0xcc, 0xcc, 0xcc, 0xcc,
-    0xcf, 0x0,  0x0,  0x0,  0x0,  0x0,  0x3c, 0x66, 0x66, 0x60, 0x60, 0x60,
-    0x60, 0x60, 0x66, 0x66, 0x3c, 0xc,  0x6,  0x1c, 0x30, 0x18, 0x0,  0x7e,
-    0x60, 0x60, 0x60, 0x7c, 0x60, 0x60, 0x60, 0x60, 0x7e, 0x0,  0x0,  0x0,
-    0xc,  0x18, 0x0,  0x7e, 0x60, 0x60, 0x60, 0x7c, 0x60, 0x60, 0x60, 0x60,
-    0x7e, 0x0,  0x0,  0x0,  0x18, 0x66, 0x0,  0x7e, 0x60, 0x60, 0x60, 0x7c,
-    0x60, 0x60, 0x60, 0x60, 0x7e, 0x0,  0x0,  0x0,  0x66, 0x66, 0x0,  0x7e,
-    0x60, 0x60, 0x60, 0x7c, 0x60, 0x60, 0x60, 0x60, 0x7e, 0x0,  0x0,  0x0,
-    0x30, 0x18, 0x0,  0x7e, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18,
-    0x7e, 0x0,  0x0,  0x0,  0xc,  0x18, 0x0,  0x7e, 0x18, 0x18, 0x18, 0x18,
-    0x18, 0x18, 0x18, 0x18, 0x7e, 0x0,  0x0,  0x0,  0x18, 0x66, 0x0,  0x7e,
-    0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x7e, 0x0,  0x0,  0x0,
-    0x66, 0x66, 0x0,  0x7e, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18,
-    0x7e, 0x0,  0x0,  0x0,  0x0,  0x0,  0x78, 0x6c, 0x66, 0x66, 0x66, 0xf6,
-    0x66, 0x66, 0x66, 0x6c, 0x78, 0x0,  0x0,  0x0,  0x76, 0xdc, 0x0,  0xc6,
-    0xc6, 0xe6, 0xf6, 0xde, 0xce, 0xc6, 0xc6, 0xc6, 0xc6, 0x0,  0x0,  0x0,
-    0x30, 0x18, 0x0,  0x3c, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66,
-    0x3c, 0x0,  0x0,  0x0,  0xc,  0x18, 0x0,  0x3c, 0x66, 0x66, 0x66, 0x66,
-    0x66, 0x66, 0x66, 0x66, 0x3c, 0x0,  0x0,  0x0,  0x18, 0x66, 0x0,  0x3c,
-    0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x3c, 0x0,  0x0,  0x0,
-    0x76, 0xdc, 0x0,  0x3c, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66,
-    0x3c, 0x0,  0x0,  0x0,  0x66, 0x66, 0x0,  0x3c, 0x66, 0x66, 0x66, 0x66,
-    0x66, 0x66, 0x66, 0x66, 0x3c, 0x0,  0x0,  0x0,  0x0,  0x0,  0x0,  0x0,
-    0x82, 0xc6, 0x6c, 0x38, 0x6c, 0xc6, 0x82, 0x0,  0x0,  0x0,  0x0,  0x0,
-    0x0,  0x0,  0x3e, 0x66, 0x6e, 0x6e, 0x6e, 0x7e, 0x76, 0x76, 0x76, 0x66,
-    0x7c, 0x0,  0x0,  0x0,  0x30, 0x18, 0x0,  0x66, 0x66, 0x66, 0x66, 0x66,
-    0x66, 0x66, 0x66, 0x66, 0x3c, 0x0,  0x0,  0x0,  0xc,  0x18, 0x0,  0x66,
-    0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x3c, 0x0,  0x0,  0x0,
-    0x18, 0x66, 0x0,  0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66,
-    0x3c, 0x0,  0x0,  0x0,  0x66, 0x66, 0x0,  0x66, 0x66, 0x66, 0x66, 0x66,
-    0x66, 0x66, 0x66, 0x66, 0x3c, 0x0,  0x0,  0x0,  0xc,  0x18, 0x0,  0x66,
-    0x66, 0x66, 0x66, 0x3c, 0x18, 0x18, 0x18, 0x18, 0x18, 0x0,  0x0,  0x0,
-    0x0,  0x0,  0xc0, 0xc0, 0xfc, 0xc6, 0xc6, 0xc6, 0xc6, 0xc6, 0xfc, 0xc0,
-    0xc0, 0x0,  0x0,  0x0,  0x0,  0x0,  0x78, 0xcc, 0xcc, 0xcc, 0xd8, 0xcc,
-    0xc6, 0xc6, 0xc6, 0xc6, 0xcc, 0x0,  0x0,  0x0,  0x0,  0x0,  0x30, 0x18,
-    0x0,  0x0,  0x3c, 0x6,  0x3e, 0x66, 0x66, 0x66, 0x3e, 0x0,  0x0,  0x0,
-    0x0,  0x0,  0xc,  0x18, 0x0,  0x0,  0x3c, 0x6,  0x3e, 0x66, 0x66, 0x66,
-    0x3e, 0x0,  0x0,  0x0,  0x0,  0x18, 0x3c, 0x66, 0x0,  0x0,  0x3c, 0x6,
-    0x3e, 0x66, 0x66, 0x66, 0x3e, 0x0,  0x0,  0x0,  0x0,  0x0,  0x76, 0xdc,
-    0x0,  0x0,  0x3c, 0x6,  0x3e, 0x66, 0x66, 0x66, 0x3e, 0x0,  0x0,  0x0,
-    0x0,  0x0,  0x66, 0x66, 0x0,  0x0,  0x3c, 0x6,  0x3e, 0x66, 0x66, 0x66,
-    0x3e, 0x0,  0x0,  0x0,  0x0,  0x0,  0x3c, 0x66, 0x3c, 0x0,  0x3c, 0x6,
-    0x3e, 0x66, 0x66, 0x66, 0x3e, 0x0,  0x0,  0x0,  0x0,  0x0,  0x0,  0x0,
-    0x0,  0x0,  0x7e, 0x1b, 0x1b, 0x7f, 0xd8, 0xd8, 0x77, 0x0,  0x0,  0x0,
-    0x0,  0x0,  0x0,  0x0,  0x0,  0x0,  0x3c, 0x66, 0x60, 0x60, 0x60, 0x66,
-    0x3c, 0xc,  0x6,  0x1c, 0x0,  0x0,  0x30, 0x18, 0x0,  0x0,  0x3c, 0x66,
-    0x66, 0x7e, 0x60, 0x60, 0x3c, 0x0,  0x0,  0x0,  0x0,  0x0,  0xc,  0x18,
-    0x0,  0x0,  0x3c, 0x66, 0x66, 0x7e, 0x60, 0x60, 0x3c, 0x0,  0x0,  0x0,
-    0x0,  0x18, 0x3c, 0x66, 0x0,  0x0,  0x3c, 0x66, 0x66, 0x7e, 0x60, 0x60,
-    0x3c, 0x0,  0x0,  0x0,  0x0,  0x0,  0x66, 0x66, 0x0,  0x0,  0x3c, 0x66,
-    0x66, 0x7e, 0x60, 0x60, 0x3c, 0x0,  0x0,  0x0,  0x0,  0x0,  0x30, 0x18,
-    0x0,  0x0,  0x38, 0x18, 0x18, 0x18, 0x18, 0x18, 0x3c, 0x0,  0x0,  0x0,
-    0x0,  0x0,  0xc,  0x18, 0x0,  0x0,  0x38, 0x18, 0x18, 0x18, 0x18, 0x18,
-    0x3c, 0x0,  0x0,  0x0,  0x0,  0x18, 0x3c, 0x66, 0x0,  0x0,  0x38, 0x18,
-    0x18, 0x18, 0x18, 0x18, 0x3c, 0x0,  0x0,  0x0,  0x0,  0x0,  0x66, 0x66,
-    0x0,  0x0,  0x38, 0x18, 0x18, 0x18, 0x18, 0x18, 0x3c, 0x0,  0x0,  0x0,
-    0x0,  0x36, 0x1c, 0x1c, 0x36, 0x6,  0x3e, 0x66, 0x66, 0x66, 0x66, 0x66,
-    0x3c, 0x0,  0x0,  0x0,  0x0,  0x0,  0x76, 0xdc, 0x0,  0x0,  0x7c, 0x66,
-    0x66, 0x66, 0x66, 0x66, 0x66, 0x0,  0x0,  0x0,  0x0,  0x0,  0x30, 0x18,
-    0x0,  0x0,  0x3c, 0x66, 0x66, 0x66, 0x66, 0x66, 0x3c, 0x0,  0x0,  0x0,
-    0x0,  0x0,  0xc,  0x18, 0x0,  0x0,  0x3c, 0x66, 0x66, 0x66, 0x66, 0x66,
-    0x3c, 0x0,  0x0,  0x0,  0x0,  0x18, 0x3c, 0x66, 0x0,  0x0,  0x3c, 0x66,
-    0x66, 0x66, 0x66, 0x66, 0x3c, 0x0,  0x0,  0x0,  0x0,  0x0,  0x76, 0xdc,
-    0x0,  0x0,  0x3c, 0x66, 0x66, 0x66, 0x66, 0x66, 0x3c, 0x0,  0x0,  0x0,
-    0x0,  0x0,  0x66, 0x66, 0x0,  0x0,  0x3c, 0x66, 0x66, 0x66, 0x66, 0x66,
-    0x3c, 0x0,  0x0,  0x0,  0x0,  0x0,  0x0,  0x0,  0x18, 0x18, 0x0,  0x7e,
-    0x0,  0x18, 0x18, 0x0,  0x0,  0x0,  0x0,  0x0,  0x0,  0x0,  0x0,  0x0,
-    0x0,  0x0,  0x3d, 0x66, 0x6e, 0x7e, 0x76, 0x66, 0xbc, 0x0,  0x0,  0x0,
-    0x0,  0x0,  0x30, 0x18, 0x0,  0x0,  0x66, 0x66, 0x66, 0x66, 0x66, 0x66,
-    0x3e, 0x0,  0x0,  0x0,  0x0,  0x0,  0xc,  0x18, 0x0,  0x0,  0x66, 0x66,
-    0x66, 0x66, 0x66, 0x66, 0x3e, 0x0,  0x0,  0x0,  0x0,  0x18, 0x3c, 0x66,
-    0x0,  0x0,  0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x3e, 0x0,  0x0,  0x0,
-    0x0,  0x0,  0x66, 0x66, 0x0,  0x0,  0x66, 0x66, 0x66, 0x66, 0x66, 0x66,
-    0x3e, 0x0,  0x0,  0x0,  0x0,  0x0,  0xc,  0x18, 0x0,  0x0,  0x66, 0x66,
-    0x66, 0x66, 0x66, 0x66, 0x3e, 0x6,  0x6,  0x3c, 0x0,  0x0,  0x0,  0x60,
-    0x60, 0x60, 0x7c, 0x66, 0x66, 0x66, 0x66, 0x66, 0x7c, 0x60, 0x60, 0x60,
-    0x0,  0x0,  0x66, 0x66, 0x0,  0x0,  0x66, 0x66, 0x66, 0x66, 0x66, 0x66,
-    0x3e, 0x6,  0x6,  0x3c};
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+extern const unsigned char DBGP_UNSCII16[2298];
+
+#ifdef DBGP_UNSCII16_IMPLEMENTATION
+const unsigned char DBGP_UNSCII16[2298] =
+    "\x44\x42\x47\x5a\x01\x10\x00\x00\x00\x01\x00\x00\x00\x00\x8c\x01\x00\x0a"
+    "\xe0\xe0\x80\x80\xea\xea\x2a\x2a\xee\xee\x0a\x80\x01\x00\x87\x10\x00\x01"
+    "\xe4\xe4\x87\x10\x00\x03\xca\xca\x8a\x8a\x89\x10\x00\x06\xce\xce\x84\x84"
+    "\xe4\xe4\x04\x80\x01\x00\x85\x10\x00\x05\x8a\x8a\xea\xea\x0e\x0e\x83\x10"
+    "\x00\x07\xa0\xa0\xea\xea\xaa\xaa\xac\xac\x83\x50\x00\x0d\xc0\xc0\xa0\xa0"
+    "\xc8\xc8\xa8\xa8\xc8\xc8\x08\x08\x0e\x0e\x83\x10\x00\x07\xce\xce\xa8\xa8"
+    "\xce\xce\x02\x02\x81\x10\x00\x00\xa0\x80\x01\x00\x02\xee\xee\xa4\x80\x01"
+    "\x00\x83\x50\x00\x00\x80\x80\x01\x00\x06\x8e\x8e\x88\x88\xec\xec\x08\x80"
+    "\x01\x00\x83\x20\x00\x05\xae\xae\xa4\xa4\x44\x44\x89\x70\x00\x03\x88\x88"
+    "\x8c\x8c\x83\x20\x00\x81\xc0\x00\x07\x8e\x8e\x8a\x8a\xee\xee\x0c\x0c\x85"
+    "\xc0\x00\x07\xee\xee\x2a\x2a\xea\xea\x0a\x0a\x81\x70\x00\x83\x10\x00\x01"
+    "\x24\x24\x81\xb0\x00\x85\x80\x00\x00\xa8\x80\x01\x00\x89\x90\x00\x05\xa4"
+    "\xa4\xac\xac\xc4\xc4\x87\x20\x00\x05\xae\xae\xa2\xa2\xce\xce\x87\xb0\x00"
+    "\x81\x10\x00\x01\xc6\xc6\x83\xb0\x00\x81\xd0\x00\x00\xaa\x80\x01\x00\x81"
+    "\xc0\x00\x01\x02\x02\x83\xf0\x00\x81\x10\x00\x85\xf0\x00\x87\x50\x01\x87"
+    "\x20\x01\x09\xcc\xcc\x8a\x8a\xec\xec\x0a\x0a\x0c\x0c\x87\xb0\x00\x81\xa0"
+    "\x00\x87\x60\x01\x01\x8e\x8e\x85\x10\x00\x02\x3c\x3c\x66\x80\x01\x00\x05"
+    "\x30\x30\x18\x18\x00\x00\x81\x04\x00\x85\xf0\x00\x01\xe8\xe8\x83\x40\x01"
+    "\x85\x00\x01\x01\x8e\x8e\x83\x40\x01\x81\xc0\x01\x05\xae\xae\xa8\xa8\xee"
+    "\xee\x85\x10\x00\x81\x50\x01\x03\xc8\xc8\xae\xae\x87\x60\x01\x89\x20\x00"
+    "\x8e\x02\x00\x00\x18\x84\x01\x00\x83\x6f\x00\x01\x00\x00\x80\x7f\x00\x8b"
+    "\x23\x02\x03\x6c\x6c\x6c\xfe\x84\x04\x00\x83\x30\x00\x08\x3c\x66\x60\x30"
+    "\x18\x0c\x06\x66\x3c\x83\x31\x00\x0b\x06\xc6\xcc\xcc\x18\x18\x30\x30\x66"
+    "\x66\xc6\xc0\x81\x5d\x00\x0a\x38\x6c\x6c\x38\x30\x7a\xde\xcc\xcc\xcc\x76"
+    "\x84\x60\x00\x00\x30\x89\x70\x00\x00\x0c\x81\x2c\x00\x82\x02\x00\x01\x18"
+    "\x18\x80\x10\x01\x00\x00\x81\x07\x00\x83\x01\x00\x86\x29\x00\x03\x66\x66"
+    "\x3c\xff\x80\x07\x01\x86\x84\x00\x80\xa3\x00\x00\x7e\x82\xa2\x00\x8a\x02"
+    "\x00\x00\x38\x80\x75\x00\x00\x60\x85\x57\x00\x00\x7e\x8c\x1d\x00\x80\x2a"
+    "\x00\x83\x32\x00\x03\x03\x03\x06\x06\x82\x5b\x00\x03\x30\x60\x60\xc0\x84"
+    "\xa0\x00\x08\xc6\xc6\xce\xd6\xe6\xc6\xc6\x6c\x38\x83\x28\x00\x01\x38\x78"
+    "\x84\x04\x01\x83\x45\x00\x80\x81\x01\x80\x33\x00\x80\x5c\x00\x00\x60\x88"
+    "\x10\x00\x02\x1c\x06\x06\x80\x96\x00\x82\x6c\x00\x06\x0c\x1c\x3c\x6c\xcc"
+    "\xcc\xfe\x81\xb5\x00\x82\x75\x00\x05\x7e\x60\x60\x60\x7c\x06\x87\x20\x00"
+    "\x00\x1c\x80\x6a\x00\x00\x7c\x81\xc5\x01\x84\x30\x00\x00\x7e\x80\x1c\x00"
+    "\x81\xdd\x00\x85\xc2\x00\x81\xe1\x01\x02\x76\x3c\x6e\x86\x20\x00\x82\xf1"
+    "\x01\x00\x3e\x81\x25\x00\x83\x90\x00\x84\xb9\x00\x85\x07\x00\x86\x10\x00"
+    "\x86\xf0\x00\x82\x9d\x00\x81\x82\x01\x83\x2f\x00\x81\x63\x00\x84\x04\x00"
+    "\x83\x40\x00\x82\x9e\x01\x81\xc1\x00\x85\x5f\x00\x80\xce\x00\x87\xe0\x01"
+    "\x0b\x00\x7c\xc6\xc6\xc6\xde\xde\xde\xdc\xc0\xc0\x7c\x83\x5f\x00\x81\x72"
+    "\x02\x00\x7e\x82\xb1\x00\x83\x20\x00\x80\x81\x02\x02\x6c\x78\x6c\x80\x87"
+    "\x02\x83\x20\x00\x80\x91\x02\x80\xe2\x00\x01\x60\x60\x85\x00\x01\x82\x1b"
+    "\x00\x81\xa5\x02\x01\x6c\x78\x83\x7d\x00\x81\x1e\x00\x00\x7c\x81\x23\x00"
+    "\x83\x85\x01\x82\x10\x01\x82\x32\x00\x86\x81\x00\x01\x60\x60\x81\xef\x00"
+    "\x01\x66\x3e\x82\xa1\x00\x82\x1b\x01\x88\x70\x00\x81\xdb\x01\x89\x80\x01"
+    "\x80\x4b\x01\x82\x03\x00\x85\x70\x01\x00\xc6\x80\x60\x02\x06\xd8\xf0\xd8"
+    "\xcc\xcc\xc6\xc6\x82\xa0\x00\x83\x5b\x00\x87\x70\x00\x05\xc6\xee\xee\xfe"
+    "\xd6\xd6\x80\xd5\x00\x84\x20\x00\x08\xc6\xc6\xe6\xe6\xf6\xfe\xde\xce\xce"
+    "\x84\x30\x00\x82\x51\x03\x88\x90\x01\x82\x9c\x01\x83\xa1\x00\x8d\x20\x00"
+    "\x82\x53\x01\x83\x20\x00\x82\xe5\x00\x85\x40\x00\x83\xf0\x02\x85\xd0\x01"
+    "\x86\xb0\x00\x83\x92\x02\x86\x5f\x00\x84\x20\x02\x85\x6d\x00\x84\x1f\x03"
+    "\x80\xc0\x00\x80\x71\x01\x04\xd6\xd6\xfe\xee\xee\x83\xc0\x00\x01\xc3\xc3"
+    "\x81\x3a\x03\x80\x46\x03\x01\xc3\xc3\x85\x10\x00\x82\x11\x00\x85\x20\x02"
+    "\x80\x30\x02\x80\x0c\x03\x81\xb0\x02\x82\xd5\x02\x00\x3c\x84\x2e\x03\x81"
+    "\x35\x03\x80\x81\x02\x03\xc0\xc0\x60\x60\x82\x3b\x03\x04\x0c\x06\x06\x03"
+    "\x03\x81\xbf\x00\x84\x3e\x03\x81\x45\x03\x81\xa1\x02\x00\x10\x80\x80\x03"
+    "\x84\x2a\x01\x90\x05\x00\x00\xff\x80\x55\x04\x88\x39\x02\x85\x27\x00\x02"
+    "\x3c\x06\x3e\x80\x25\x01\x83\xa0\x01\x82\xcf\x01\x82\x32\x01\x83\x20\x02"
+    "\x82\x20\x00\x81\x03\x02\x84\x00\x03\x81\xa0\x01\x81\x2e\x00\x85\xd0\x01"
+    "\x83\x20\x00\x00\x66\x80\x07\x03\x83\x20\x03\x00\x1e\x80\xdf\x03\x00\x7e"
+    "\x83\xe3\x03\x86\x62\x00\x84\x30\x00\x01\x06\x06\x80\x73\x02\x87\x60\x00"
+    "\x83\x69\x04\x81\xea\x04\x83\x82\x03\x00\x1e\x82\x70\x00\x81\x26\x05\x86"
+    "\xd4\x00\x80\x63\x02\x83\x7c\x02\x82\x92\x02\x82\x8f\x00\x85\xae\x03\x85"
+    "\x30\x00\x81\x85\x00\x00\xcc\x80\x02\x02\x80\x04\x02\x86\x70\x00\x89\x60"
+    "\x00\x81\x82\x00\x83\x04\x02\x83\xc0\x03\x87\x20\x00\x81\xb5\x02\x83\x43"
+    "\x00\x86\xa0\x00\x84\x54\x03\x80\xc0\x03\x86\xc0\x02\x82\x20\x00\x80\xdd"
+    "\x00\x82\xbd\x00\x81\x52\x00\x86\xe0\x00\x87\x80\x00\x83\xf4\x01\x87\x10"
+    "\x01\x83\x6f\x00\x87\xb2\x04\x81\x01\x02\x01\xd6\x7c\x82\x40\x05\x84\x10"
+    "\x00\x00\x6c\x81\x87\x04\x8d\x40\x00\x01\x06\x06\x84\xa3\x00\x00\x7e\x82"
+    "\x81\x04\x82\xd5\x04\x00\x0e\x82\x1f\x03\x00\xf0\x82\x24\x03\x80\x40\x07"
+    "\x87\x7d\x02\x84\x31\x02\x00\xe0\x83\x8b\x00\x82\x54\x05\x00\xe0\x80\x7e"
+    "\x00\x02\x72\xd6\x9c\x86\x77\x00\x80\x7a\x00\x83\xd0\x06\x01\xa4\xa4\x81"
+    "\xe0\x06\x85\xa0\x07\x03\xee\xee\xaa\xaa\x87\x20\x07\x05\xa0\xa0\xe4\xe4"
+    "\xac\xac\x85\x20\x07\x83\x40\x06\x03\xa2\xa2\xee\xee\x85\x70\x06\x85\x10"
+    "\x00\x85\x70\x06\x05\x40\x40\x4e\x4e\x4a\x4a\x87\xc0\x06\x83\x50\x07\x01"
+    "\xa8\xa8\x87\xa0\x06\x03\xee\xee\x28\x28\x87\x90\x06\x83\xb0\x07\x85\xa0"
+    "\x06\x83\xf0\x07\x01\xa8\xa8\x89\xa0\x06\x02\xe2\xe2\xa2\x80\x01\x00\x83"
+    "\xb0\x07\x85\xb0\x06\x01\x4e\x4e\x87\xd0\x06\x02\xec\xec\x8a\x80\x01\x00"
+    "\x85\x40\x07\x81\x60\x08\x83\x10\x00\x87\x50\x08\x83\x40\x08\x87\xf0\x07"
+    "\x01\x22\x22\x87\xc0\x00\x83\x10\x00\x01\xe6\xe6\x87\xc0\x07\x81\x30\x07"
+    "\x85\x90\x08\x83\x00\x01\x03\x8c\x8c\x84\x84\x89\x00\x01\x03\x82\x82\x8e"
+    "\x8e\x8b\xd0\x00\x81\x90\x08\x85\x50\x08\x81\xa0\x08\x85\x90\x07\x03\xa0"
+    "\xa0\xe0\xe0\x81\xf0\x08\x03\xae\xae\x0e\x0e\x89\x80\x08\x81\x40\x01\x85"
+    "\xa0\x08\x81\x20\x09\x87\x10\x00\x81\xf0\x08\x83\x70\x09\x87\xb0\x07\x81"
+    "\x80\x09\x89\xc0\x07\x8b\x90\x09\x81\x10\x09\x89\x50\x01\x85\xd0\x08\x85"
+    "\x70\x09\x8d\x00\x08\x02\xea\xea\x8e\x80\x01\x00\x87\xa0\x01\x81\xf0\x01"
+    "\x01\xae\xae\x83\x50\x09\x8e\x02\x00\x83\x69\x08\x86\x4f\x02\x81\x10\x08"
+    "\x81\xee\x03\x82\xa4\x04\x82\x49\x02\x80\xd0\x07\x02\x60\x60\xf0\x81\x00"
+    "\x06\x00\xfc\x82\x59\x02\x00\x66\x81\xa2\x08\x00\x3c\x87\x25\x08\x83\xc0"
+    "\x04\x00\x7e\x81\xa3\x07\x83\x3f\x00\x82\x98\x02\x86\xa0\x02\x81\x2e\x08"
+    "\x04\x38\x6c\x66\x36\x1c\x81\x32\x08\x81\x5f\x08\x8d\x82\x00\x09\x3c\x42"
+    "\x81\x9d\xb1\xb1\xb1\x9d\x81\x42\x82\x60\x07\x80\x68\x03\x80\x8c\x04\x00"
+    "\x3e\x8a\xd2\x07\x04\x33\x66\xcc\x66\x33\x89\x38\x00\x00\xfe\x81\x25\x06"
+    "\x8a\x45\x00\x88\x0b\x00\x06\x42\x81\xb9\xa5\xb9\xa5\xa5\x83\x50\x00\x8e"
+    "\x19\x08\x80\x60\x09\x88\x2d\x00\x82\x36\x00\x80\x60\x03\x82\x60\x08\x82"
+    "\x45\x08\x01\x38\x6c\x81\xfc\x07\x87\xfb\x04\x80\x10\x00\x01\x38\x0c\x84"
+    "\x2b\x08\x80\x43\x00\x83\x4c\x08\x8c\x41\x00\x84\x04\x06\x80\x05\x07\x80"
+    "\x02\x09\x01\x3e\x7a\x80\x01\x00\x01\x3a\x1a\x81\x01\x00\x87\x27\x00\x8d"
+    "\xbd\x08\x83\x3c\x00\x05\x0c\x06\x1c\x00\x30\x70\x8b\x2b\x05\x83\x21\x08"
+    "\x00\x3c\x8a\xd2\x08\x80\xfe\x00\x01\x66\xcc\x84\x3d\x00\x04\x40\xc6\x46"
+    "\x4c\x4c\x81\x70\x09\x03\x62\x66\xca\xcf\x80\x81\x0a\x86\x10\x00\x03\x6c"
+    "\x62\xc4\xc8\x81\xc1\x0a\x02\x26\x66\x2c\x82\x90\x09\x84\x20\x00\x82\x49"
+    "\x0a\x81\xfe\x08\x83\xc0\x08\x01\x30\x18\x88\xf1\x07\x81\x83\x00\x8c\x10"
+    "\x00\x01\x18\x66\x8b\x20\x00\x01\x76\xdc\x8b\x30\x00\x80\x1e\x0a\x8a\x40"
+    "\x00\x00\x3c\x80\x16\x09\x81\x42\x08\x85\x50\x00\x04\x00\x00\x3f\x7c\xfc"
+    "\x80\x1f\x09\x80\xff\x09\x01\xcc\xcf\x85\xcf\x00\x82\x0e\x08\x82\x60\x07"
+    "\x00\x1c\x80\x80\x00\x86\x21\x08\x81\xb5\x09\x80\x80\x00\x8a\x10\x00\x80"
+    "\x80\x00\x8a\x20\x00\x80\x8e\x0a\x8a\x30\x00\x81\x40\x00\x85\x04\x05\x85"
+    "\x40\x00\x89\x10\x00\x81\x40\x00\x89\x20\x00\x81\x40\x00\x89\x30\x00\x84"
+    "\xc0\x08\x00\xf6\x80\xaf\x05\x82\xc0\x08\x80\xe0\x00\x80\x31\x08\x01\xf6"
+    "\xde\x80\x2e\x08\x82\x60\x08\x80\x20\x01\x86\x31\x08\x81\xf0\x09\x80\x20"
+    "\x01\x8a\x10\x00\x80\x20\x01\x8a\x20\x00\x80\x20\x01\x8a\x30\x00\x80\x3e"
+    "\x0b\x8a\x40\x00\x81\x13\x01\x00\x82\x82\xee\x05\x00\x82\x84\x0e\x00\x08"
+    "\x3e\x66\x6e\x6e\x6e\x7e\x76\x76\x76\x82\x60\x09\x80\x90\x01\x85\x6f\x00"
+    "\x85\x70\x00\x8a\x10\x00\x80\x90\x01\x8a\x20\x00\x80\x9e\x0b\x91\x30\x00"
+    "\x83\x41\x08\x82\xe0\x00\x02\xc0\xc0\xfc\x82\x0d\x09\x00\xfc\x83\xef\x0a"
+    "\x01\x00\x78\x80\x8a\x0b\x00\xd8\x80\x3d\x09\x80\x48\x09\x82\x00\x01\x80"
+    "\x02\x02\x8a\xf0\x07\x80\x02\x02\x89\x00\x08\x80\xdf\x0b\x8b\x10\x08\x80"
+    "\x02\x02\x8a\x20\x08\x81\x20\x0c\x89\x30\x08\x81\x02\x02\x89\x40\x08\x81"
+    "\x85\x00\x06\x7e\x1b\x1b\x7f\xd8\xd8\x77\x86\x10\x00\x84\x40\x08\x81\xf0"
+    "\x02\x83\x80\x00\x88\x30\x08\x82\x80\x00\x87\x40\x08\x83\x80\x00\x88\x50"
+    "\x08\x82\x70\x00\x88\x60\x08\x81\xc0\x00\x80\xfc\x0b\x80\x5e\x04\x87\x40"
+    "\x00\x88\x10\x00\x82\xc0\x00\x89\x20\x00\x81\xd0\x0c\x88\x30\x00\x03\x36"
+    "\x1c\x1c\x36\x84\xc0\x08\x83\x10\x0a\x81\xe0\x00\x89\x90\x08\x84\xa0\x00"
+    "\x86\x20\x00\x84\xa0\x00\x85\x30\x00\x85\xa0\x00\x8a\x40\x00\x89\x60\x08"
+    "\x84\xb0\x00\x86\x60\x00\x82\x59\x0d\x00\x7e\x85\x7e\x0b\x83\x13\x00\x01"
+    "\x3d\x66\x80\x02\x02\x01\x66\xbc\x86\x70\x00\x83\x7f\x00\x87\x90\x01\x88"
+    "\x10\x00\x82\x90\x01\x89\x20\x00\x81\xa0\x0d\x94\x30\x00\x83\x40\x08\x87"
+    "\xc0\x09\x82\xe3\x0a\x88\x30\x00\x80\x60\x08";
+#endif // DBGP_UNSCII16_IMPLEMENTATION
+
+#ifdef __cplusplus
+}
+#endif
 
 #endif // DBGP_UNSCII16_H
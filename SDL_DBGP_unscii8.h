@@ -1,6 +1,11 @@
 /*
  * Raw data to use with SDL_DBGP. Font is
  * [UNSCII-8](https://github.com/viznut/unscii), in the public domain.
+ *
+ * 1778 bytes (with the final NUL), compressed from 2048 bytes.
+ *
+ * Define DBGP_UNSCII8_IMPLEMENTATION in exactly one source file before
+ * including this header.
  */
 
 #ifndef DBGP_UNSCII8_H
@@ -9,177 +14,118 @@
 static const unsigned int DBGP_UNSCII8_WIDTH = 8;
 static const unsigned int DBGP_UNSCII8_HEIGHT = 8;
 static const unsigned int DBGP_UNSCII8_NB_GLYPHS = 256;
-static const unsigned char DBGP_UNSCII8[256 * 8] = {
-    0x0,  0x0,  0x0,  0x0,  0x0,  0x0,  0x0,  0x0,  0xe0, 0x80, 0xea, 0x2a,
-    0xee, 0xa,  0xa,  0x0,  0xe0, 0x80, 0xea, 0x2a, 0xe4, 0xa,  0xa,  0x0,
-    0xe0, 0x80, 0xca, 0x8a, 0xe4, 0xa,  0xa,  0x0,  0xe0, 0x80, 0xce, 0x84,
-    0xe4, 0x4,  0x4,  0x0,  0xe0, 0x80, 0xce, 0x8a, 0xea, 0xe,  0x4,  0x0,
-    0xe0, 0xa0, 0xea, 0xaa, 0xac, 0xa,  0xa,  0x0,  0xc0, 0xa0, 0xc8, 0xa8,
-    0xc8, 0x8,  0xe,  0x0,  0xc0, 0xa0, 0xce, 0xa8, 0xce, 0x2,  0xe,  0x0,
-    0xa0, 0xa0, 0xee, 0xa4, 0xa4, 0x4,  0x4,  0x0,  0x80, 0x80, 0x8e, 0x88,
-    0xec, 0x8,  0x8,  0x0,  0xa0, 0xa0, 0xae, 0xa4, 0x44, 0x4,  0x4,  0x0,
-    0xe0, 0x80, 0xce, 0x88, 0x8c, 0x8,  0x8,  0x0,  0xe0, 0x80, 0x8e, 0x8a,
-    0xee, 0xc,  0xa,  0x0,  0xe0, 0x80, 0xee, 0x2a, 0xea, 0xa,  0xe,  0x0,
-    0xe0, 0x80, 0xee, 0x24, 0xe4, 0x4,  0xe,  0x0,  0xc0, 0xa0, 0xa8, 0xa8,
-    0xc8, 0x8,  0xe,  0x0,  0xc0, 0xa0, 0xa4, 0xac, 0xc4, 0x4,  0xe,  0x0,
-    0xc0, 0xa0, 0xae, 0xa2, 0xce, 0x8,  0xe,  0x0,  0xc0, 0xa0, 0xae, 0xa2,
-    0xc6, 0x2,  0xe,  0x0,  0xc0, 0xa0, 0xaa, 0xaa, 0xce, 0x2,  0x2,  0x0,
-    0xe0, 0xa0, 0xaa, 0xaa, 0xac, 0xa,  0xa,  0x0,  0xe0, 0x80, 0xea, 0x2a,
-    0xee, 0x4,  0x4,  0x0,  0xe0, 0x80, 0xcc, 0x8a, 0xec, 0xa,  0xc,  0x0,
-    0xe0, 0x80, 0x8e, 0x8a, 0xea, 0xa,  0xa,  0x0,  0xe0, 0x80, 0xca, 0x8e,
-    0xea, 0xa,  0xa,  0x0,  0x3c, 0x66, 0x66, 0x30, 0x18, 0x0,  0x18, 0x0,
-    0xe0, 0x80, 0xce, 0x88, 0xe8, 0x8,  0xe,  0x0,  0xe0, 0x80, 0xce, 0x88,
-    0x8e, 0x2,  0xe,  0x0,  0xe0, 0x80, 0xae, 0xa8, 0xee, 0x2,  0xe,  0x0,
-    0xe0, 0xa0, 0xee, 0xc8, 0xae, 0x2,  0xe,  0x0,  0xa0, 0xa0, 0xae, 0xa8,
-    0xee, 0x2,  0xe,  0x0,  0x0,  0x0,  0x0,  0x0,  0x0,  0x0,  0x0,  0x0,
-    0x18, 0x18, 0x18, 0x18, 0x18, 0x0,  0x18, 0x0,  0x66, 0x66, 0x66, 0x0,
-    0x0,  0x0,  0x0,  0x0,  0x6c, 0x6c, 0xfe, 0x6c, 0xfe, 0x6c, 0x6c, 0x0,
-    0x18, 0x3e, 0x60, 0x3c, 0x6,  0x7c, 0x18, 0x0,  0x0,  0xc6, 0xcc, 0x18,
-    0x30, 0x66, 0xc6, 0x0,  0x38, 0x6c, 0x38, 0x76, 0xdc, 0xcc, 0x76, 0x0,
-    0x18, 0x18, 0x30, 0x0,  0x0,  0x0,  0x0,  0x0,  0xc,  0x18, 0x30, 0x30,
-    0x30, 0x18, 0xc,  0x0,  0x30, 0x18, 0xc,  0xc,  0xc,  0x18, 0x30, 0x0,
-    0x0,  0x66, 0x3c, 0xff, 0x3c, 0x66, 0x0,  0x0,  0x0,  0x18, 0x18, 0x7e,
-    0x18, 0x18, 0x0,  0x0,  0x0,  0x0,  0x0,  0x0,  0x0,  0x18, 0x18, 0x30,
-    0x0,  0x0,  0x0,  0x7e, 0x0,  0x0,  0x0,  0x0,  0x0,  0x0,  0x0,  0x0,
-    0x0,  0x18, 0x18, 0x0,  0x3,  0x6,  0xc,  0x18, 0x30, 0x60, 0xc0, 0x0,
-    0x3c, 0x66, 0x6e, 0x76, 0x66, 0x66, 0x3c, 0x0,  0x18, 0x38, 0x18, 0x18,
-    0x18, 0x18, 0x7e, 0x0,  0x3c, 0x66, 0xc,  0x18, 0x30, 0x60, 0x7e, 0x0,
-    0x3c, 0x66, 0x6,  0x1c, 0x6,  0x66, 0x3c, 0x0,  0x1c, 0x3c, 0x6c, 0xcc,
-    0xfe, 0xc,  0xc,  0x0,  0x7e, 0x60, 0x7c, 0x6,  0x6,  0x66, 0x3c, 0x0,
-    0x1c, 0x30, 0x60, 0x7c, 0x66, 0x66, 0x3c, 0x0,  0x7e, 0x6,  0x6,  0xc,
-    0x18, 0x18, 0x18, 0x0,  0x3c, 0x66, 0x66, 0x3c, 0x66, 0x66, 0x3c, 0x0,
-    0x3c, 0x66, 0x66, 0x3e, 0x6,  0xc,  0x38, 0x0,  0x0,  0x18, 0x18, 0x0,
-    0x0,  0x18, 0x18, 0x0,  0x0,  0x18, 0x18, 0x0,  0x0,  0x18, 0x18, 0x30,
-    0xc,  0x18, 0x30, 0x60, 0x30, 0x18, 0xc,  0x0,  0x0,  0x0,  0x7e, 0x0,
-    0x7e, 0x0,  0x0,  0x0,  0x60, 0x30, 0x18, 0xc,  0x18, 0x30, 0x60, 0x0,
-    0x3c, 0x66, 0x6,  0xc,  0x18, 0x0,  0x18, 0x0,  0x7c, 0xc6, 0xde, 0xde,
-    0xde, 0xc0, 0x7c, 0x0,  0x18, 0x3c, 0x66, 0x66, 0x7e, 0x66, 0x66, 0x0,
-    0x7c, 0x66, 0x66, 0x7c, 0x66, 0x66, 0x7c, 0x0,  0x3c, 0x66, 0x60, 0x60,
-    0x60, 0x66, 0x3c, 0x0,  0x78, 0x6c, 0x66, 0x66, 0x66, 0x6c, 0x78, 0x0,
-    0x7e, 0x60, 0x60, 0x7c, 0x60, 0x60, 0x7e, 0x0,  0x7e, 0x60, 0x60, 0x7c,
-    0x60, 0x60, 0x60, 0x0,  0x3c, 0x66, 0x60, 0x6e, 0x66, 0x66, 0x3e, 0x0,
-    0x66, 0x66, 0x66, 0x7e, 0x66, 0x66, 0x66, 0x0,  0x7e, 0x18, 0x18, 0x18,
-    0x18, 0x18, 0x7e, 0x0,  0x6,  0x6,  0x6,  0x6,  0x6,  0x66, 0x3c, 0x0,
-    0xc6, 0xcc, 0xd8, 0xf0, 0xd8, 0xcc, 0xc6, 0x0,  0x60, 0x60, 0x60, 0x60,
-    0x60, 0x60, 0x7e, 0x0,  0xc6, 0xee, 0xfe, 0xd6, 0xc6, 0xc6, 0xc6, 0x0,
-    0xc6, 0xe6, 0xf6, 0xde, 0xce, 0xc6, 0xc6, 0x0,  0x3c, 0x66, 0x66, 0x66,
-    0x66, 0x66, 0x3c, 0x0,  0x7c, 0x66, 0x66, 0x7c, 0x60, 0x60, 0x60, 0x0,
-    0x3c, 0x66, 0x66, 0x66, 0x66, 0x6c, 0x36, 0x0,  0x7c, 0x66, 0x66, 0x7c,
-    0x6c, 0x66, 0x66, 0x0,  0x3c, 0x66, 0x60, 0x3c, 0x6,  0x66, 0x3c, 0x0,
-    0x7e, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x0,  0x66, 0x66, 0x66, 0x66,
-    0x66, 0x66, 0x3c, 0x0,  0x66, 0x66, 0x66, 0x66, 0x66, 0x3c, 0x18, 0x0,
-    0xc6, 0xc6, 0xc6, 0xd6, 0xfe, 0xee, 0xc6, 0x0,  0xc3, 0x66, 0x3c, 0x18,
-    0x3c, 0x66, 0xc3, 0x0,  0xc3, 0x66, 0x3c, 0x18, 0x18, 0x18, 0x18, 0x0,
-    0x7e, 0x6,  0xc,  0x18, 0x30, 0x60, 0x7e, 0x0,  0x3c, 0x30, 0x30, 0x30,
-    0x30, 0x30, 0x3c, 0x0,  0xc0, 0x60, 0x30, 0x18, 0xc,  0x6,  0x3,  0x0,
-    0x3c, 0xc,  0xc,  0xc,  0xc,  0xc,  0x3c, 0x0,  0x10, 0x38, 0x6c, 0xc6,
-    0x0,  0x0,  0x0,  0x0,  0x0,  0x0,  0x0,  0x0,  0x0,  0x0,  0x0,  0xff,
-    0x18, 0xc,  0x6,  0x0,  0x0,  0x0,  0x0,  0x0,  0x0,  0x0,  0x3c, 0x6,
-    0x3e, 0x66, 0x3e, 0x0,  0x60, 0x60, 0x7c, 0x66, 0x66, 0x66, 0x7c, 0x0,
-    0x0,  0x0,  0x3c, 0x60, 0x60, 0x60, 0x3c, 0x0,  0x6,  0x6,  0x3e, 0x66,
-    0x66, 0x66, 0x3e, 0x0,  0x0,  0x0,  0x3c, 0x66, 0x7e, 0x60, 0x3c, 0x0,
-    0x1c, 0x30, 0x7c, 0x30, 0x30, 0x30, 0x30, 0x0,  0x0,  0x0,  0x3e, 0x66,
-    0x66, 0x3e, 0x6,  0x7c, 0x60, 0x60, 0x7c, 0x66, 0x66, 0x66, 0x66, 0x0,
-    0x18, 0x0,  0x38, 0x18, 0x18, 0x18, 0x1e, 0x0,  0xc,  0x0,  0xc,  0xc,
-    0xc,  0xc,  0xc,  0x78, 0x60, 0x60, 0x66, 0x6c, 0x78, 0x6c, 0x66, 0x0,
-    0x38, 0x18, 0x18, 0x18, 0x18, 0x18, 0x1e, 0x0,  0x0,  0x0,  0xcc, 0xfe,
-    0xd6, 0xd6, 0xc6, 0x0,  0x0,  0x0,  0x7c, 0x66, 0x66, 0x66, 0x66, 0x0,
-    0x0,  0x0,  0x3c, 0x66, 0x66, 0x66, 0x3c, 0x0,  0x0,  0x0,  0x7c, 0x66,
-    0x66, 0x7c, 0x60, 0x60, 0x0,  0x0,  0x3e, 0x66, 0x66, 0x3e, 0x6,  0x6,
-    0x0,  0x0,  0x7c, 0x66, 0x60, 0x60, 0x60, 0x0,  0x0,  0x0,  0x3e, 0x60,
-    0x3c, 0x6,  0x7c, 0x0,  0x30, 0x30, 0x7e, 0x30, 0x30, 0x30, 0x1e, 0x0,
-    0x0,  0x0,  0x66, 0x66, 0x66, 0x66, 0x3e, 0x0,  0x0,  0x0,  0x66, 0x66,
-    0x66, 0x3c, 0x18, 0x0,  0x0,  0x0,  0xc6, 0xc6, 0xd6, 0x7c, 0x6c, 0x0,
-    0x0,  0x0,  0xc6, 0x6c, 0x38, 0x6c, 0xc6, 0x0,  0x0,  0x0,  0x66, 0x66,
-    0x66, 0x3e, 0x6,  0x3c, 0x0,  0x0,  0x7e, 0xc,  0x18, 0x30, 0x7e, 0x0,
-    0xe,  0x18, 0x18, 0x70, 0x18, 0x18, 0xe,  0x0,  0x18, 0x18, 0x18, 0x18,
-    0x18, 0x18, 0x18, 0x0,  0x70, 0x18, 0x18, 0xe,  0x18, 0x18, 0x70, 0x0,
-    0x76, 0xdc, 0x0,  0x0,  0x0,  0x0,  0x0,  0x0,  0xc0, 0xa0, 0xae, 0xa4,
-    0xc4, 0x4,  0x4,  0x0,  0xe0, 0xa0, 0xee, 0xaa, 0xea, 0xa,  0xe,  0x0,
-    0xe0, 0xa0, 0xe4, 0xac, 0xe4, 0x4,  0xe,  0x0,  0xe0, 0xa0, 0xee, 0xa2,
-    0xee, 0x8,  0xe,  0x0,  0xe0, 0xa0, 0xee, 0xa2, 0xee, 0x2,  0xe,  0x0,
-    0xe0, 0x40, 0x4e, 0x4a, 0xea, 0xa,  0xa,  0x0,  0xe0, 0xa0, 0xa8, 0xa8,
-    0xa8, 0x8,  0xe,  0x0,  0xe0, 0x80, 0xee, 0x28, 0xee, 0x2,  0xe,  0x0,
-    0xe0, 0x80, 0xce, 0x88, 0xee, 0x2,  0xe,  0x0,  0xa0, 0xa0, 0xee, 0xa8,
-    0xae, 0x2,  0xe,  0x0,  0xa0, 0xa0, 0xe2, 0xa2, 0xa2, 0xa,  0xe,  0x0,
-    0xa0, 0xa0, 0xae, 0xa8, 0x4e, 0x2,  0xe,  0x0,  0xe0, 0xa0, 0xec, 0x8a,
-    0x8a, 0xa,  0xc,  0x0,  0xe0, 0xa0, 0xea, 0x8a, 0x8a, 0xa,  0xe,  0x0,
-    0xc0, 0xa0, 0xce, 0xa4, 0xa4, 0x4,  0xe,  0x0,  0xe0, 0x80, 0xee, 0x22,
-    0xee, 0x8,  0xe,  0x0,  0xe0, 0x80, 0xee, 0x22, 0xe6, 0x2,  0xe,  0x0,
-    0xc0, 0xa0, 0xae, 0xa8, 0xc8, 0x8,  0xe,  0x0,  0xe0, 0xa0, 0xe4, 0x8c,
-    0x84, 0x4,  0xe,  0x0,  0xe0, 0xa0, 0xee, 0x82, 0x8e, 0x8,  0xe,  0x0,
-    0xe0, 0x80, 0xee, 0x28, 0xec, 0x8,  0xe,  0x0,  0xe0, 0x80, 0x8e, 0x88,
-    0xe8, 0x8,  0xe,  0x0,  0xa0, 0xe0, 0xea, 0xaa, 0xae, 0xe,  0xa,  0x0,
-    0xe0, 0x80, 0xee, 0x2a, 0xee, 0x8,  0x8,  0x0,  0xe0, 0x80, 0xce, 0x8a,
-    0xee, 0x8,  0x8,  0x0,  0xe0, 0xa0, 0xee, 0x2a, 0xee, 0xa,  0xe,  0x0,
-    0xe0, 0xa0, 0xee, 0x2a, 0xee, 0x2,  0xe,  0x0,  0xe0, 0xa0, 0xee, 0x2a,
-    0xee, 0xa,  0xa,  0x0,  0xe0, 0x80, 0x8e, 0x88, 0xee, 0x2,  0xe,  0x0,
-    0xe0, 0x80, 0xee, 0x24, 0xe4, 0x4,  0x4,  0x0,  0xe0, 0xa0, 0xae, 0xa8,
-    0xee, 0x2,  0xe,  0x0,  0xe0, 0xa0, 0xea, 0x8e, 0x8e, 0xa,  0xa,  0x0,
-    0xe0, 0xa0, 0xee, 0xaa, 0xae, 0x8,  0x8,  0x0,  0x0,  0x0,  0x0,  0x0,
-    0x0,  0x0,  0x0,  0x0,  0x18, 0x0,  0x18, 0x18, 0x18, 0x18, 0x18, 0x0,
-    0x0,  0x18, 0x7e, 0xd8, 0xd8, 0x7e, 0x18, 0x0,  0x38, 0x6c, 0x60, 0xf0,
-    0x60, 0x66, 0xfc, 0x0,  0x66, 0x3c, 0x66, 0x3c, 0x66, 0x0,  0x0,  0x0,
-    0xc3, 0x66, 0x3c, 0x18, 0x3c, 0x18, 0x18, 0x0,  0x18, 0x18, 0x18, 0x0,
-    0x18, 0x18, 0x18, 0x0,  0x3c, 0x60, 0x3c, 0x66, 0x66, 0x3c, 0x6,  0x3c,
-    0x66, 0x0,  0x0,  0x0,  0x0,  0x0,  0x0,  0x0,  0x7e, 0x81, 0x9d, 0xb1,
-    0xb1, 0x9d, 0x81, 0x7e, 0x3c, 0x6c, 0x6c, 0x3e, 0x0,  0x7e, 0x0,  0x0,
-    0x0,  0x33, 0x66, 0xcc, 0x66, 0x33, 0x0,  0x0,  0x0,  0x7e, 0x6,  0x6,
-    0x0,  0x0,  0x0,  0x0,  0x0,  0x0,  0x0,  0x3c, 0x0,  0x0,  0x0,  0x0,
-    0x7e, 0x81, 0xb9, 0xa5, 0xb9, 0xa5, 0x81, 0x7e, 0x7e, 0x0,  0x0,  0x0,
-    0x0,  0x0,  0x0,  0x0,  0x3c, 0x66, 0x3c, 0x0,  0x0,  0x0,  0x0,  0x0,
-    0x18, 0x18, 0x7e, 0x18, 0x18, 0x0,  0x7e, 0x0,  0x70, 0x18, 0x30, 0x60,
-    0x78, 0x0,  0x0,  0x0,  0x78, 0xc,  0x18, 0xc,  0x78, 0x0,  0x0,  0x0,
-    0xc,  0x18, 0x30, 0x0,  0x0,  0x0,  0x0,  0x0,  0x0,  0x0,  0x66, 0x66,
-    0x66, 0x7c, 0x60, 0xc0, 0x3e, 0x7a, 0x7a, 0x3a, 0x1a, 0x1a, 0x1a, 0x0,
-    0x0,  0x0,  0x0,  0x18, 0x0,  0x0,  0x0,  0x0,  0x0,  0x0,  0x0,  0x0,
-    0x0,  0x0,  0x8,  0x18, 0x30, 0x70, 0x30, 0x30, 0x30, 0x0,  0x0,  0x0,
-    0x38, 0x6c, 0x6c, 0x38, 0x0,  0x7c, 0x0,  0x0,  0x0,  0xcc, 0x66, 0x33,
-    0x66, 0xcc, 0x0,  0x0,  0x40, 0xc6, 0x4c, 0x5a, 0x36, 0x6a, 0xcf, 0x2,
-    0x40, 0xc6, 0x4c, 0x5e, 0x33, 0x66, 0xcc, 0xf,  0xc0, 0x26, 0x6c, 0x3a,
-    0xf6, 0x6a, 0xcf, 0x2,  0x18, 0x0,  0x18, 0x30, 0x60, 0x66, 0x3c, 0x0,
-    0x70, 0x0,  0x3c, 0x66, 0x7e, 0x66, 0x66, 0x0,  0xe,  0x0,  0x3c, 0x66,
-    0x7e, 0x66, 0x66, 0x0,  0x18, 0x66, 0x0,  0x3c, 0x66, 0x7e, 0x66, 0x0,
-    0x76, 0xdc, 0x0,  0x3c, 0x66, 0x7e, 0x66, 0x0,  0x66, 0x0,  0x3c, 0x66,
-    0x7e, 0x66, 0x66, 0x0,  0x18, 0x18, 0x0,  0x3c, 0x66, 0x7e, 0x66, 0x0,
-    0x3f, 0x6c, 0xcc, 0xfe, 0xcc, 0xcc, 0xcf, 0x0,  0x3c, 0x66, 0x60, 0x60,
-    0x60, 0x66, 0x3c, 0x18, 0x70, 0x0,  0xfe, 0xc0, 0xf8, 0xc0, 0xfe, 0x0,
-    0xe,  0x0,  0xfe, 0xc0, 0xf8, 0xc0, 0xfe, 0x0,  0x18, 0x66, 0x0,  0xfe,
-    0xf0, 0xc0, 0xfe, 0x0,  0x66, 0x0,  0xfe, 0xc0, 0xf8, 0xc0, 0xfe, 0x0,
-    0x70, 0x0,  0x7e, 0x18, 0x18, 0x18, 0x7e, 0x0,  0xe,  0x0,  0x7e, 0x18,
-    0x18, 0x18, 0x7e, 0x0,  0x18, 0x66, 0x0,  0x7e, 0x18, 0x18, 0x7e, 0x0,
-    0x66, 0x0,  0x7e, 0x18, 0x18, 0x18, 0x7e, 0x0,  0x78, 0x6c, 0x66, 0xf6,
-    0x66, 0x6c, 0x78, 0x0,  0x76, 0xdc, 0x0,  0xc6, 0xf6, 0xde, 0xc6, 0x0,
-    0x70, 0x0,  0x7c, 0xc6, 0xc6, 0xc6, 0x7c, 0x0,  0xe,  0x0,  0x7c, 0xc6,
-    0xc6, 0xc6, 0x7c, 0x0,  0x18, 0x66, 0x0,  0x7c, 0xc6, 0xc6, 0x7c, 0x0,
-    0x76, 0xdc, 0x0,  0x7c, 0xc6, 0xc6, 0x7c, 0x0,  0x66, 0x0,  0x7c, 0xc6,
-    0xc6, 0xc6, 0x7c, 0x0,  0x0,  0xc6, 0x6c, 0x38, 0x6c, 0xc6, 0x0,  0x0,
-    0x3e, 0x66, 0x6e, 0x7e, 0x76, 0x66, 0x7c, 0x0,  0x70, 0x0,  0xc6, 0xc6,
-    0xc6, 0xc6, 0x7c, 0x0,  0xe,  0x0,  0xc6, 0xc6, 0xc6, 0xc6, 0x7c, 0x0,
-    0x18, 0x66, 0x0,  0xc6, 0xc6, 0xc6, 0x7c, 0x0,  0x66, 0x0,  0xc6, 0xc6,
-    0xc6, 0xc6, 0x7c, 0x0,  0xe,  0x0,  0x66, 0x66, 0x3c, 0x18, 0x18, 0x0,
-    0xc0, 0xc0, 0xfc, 0xc6, 0xfc, 0xc0, 0xc0, 0x0,  0x3c, 0x66, 0x66, 0x6c,
-    0x66, 0x66, 0x6c, 0x0,  0x70, 0x0,  0x3c, 0x6,  0x3e, 0x66, 0x3e, 0x0,
-    0xe,  0x0,  0x3c, 0x6,  0x3e, 0x66, 0x3e, 0x0,  0x18, 0x66, 0x0,  0x3e,
-    0x66, 0xc6, 0x7e, 0x0,  0x76, 0xdc, 0x0,  0x3e, 0x66, 0xc6, 0x7e, 0x0,
-    0x66, 0x0,  0x3c, 0x6,  0x3e, 0x66, 0x3e, 0x0,  0x18, 0x18, 0x0,  0x3e,
-    0x66, 0xc6, 0x7e, 0x0,  0x0,  0x0,  0x7e, 0x1b, 0x7f, 0xd8, 0x77, 0x0,
-    0x0,  0x0,  0x3c, 0x60, 0x60, 0x60, 0x3c, 0x18, 0x70, 0x0,  0x3c, 0x66,
-    0x7e, 0x60, 0x3c, 0x0,  0xe,  0x0,  0x3c, 0x66, 0x7e, 0x60, 0x3c, 0x0,
-    0x18, 0x66, 0x0,  0x3c, 0x7e, 0x60, 0x3c, 0x0,  0x66, 0x0,  0x3c, 0x66,
-    0x7e, 0x60, 0x3c, 0x0,  0x70, 0x0,  0x38, 0x18, 0x18, 0x18, 0x3c, 0x0,
-    0xe,  0x0,  0x38, 0x18, 0x18, 0x18, 0x3c, 0x0,  0x18, 0x66, 0x0,  0x38,
-    0x18, 0x18, 0x3c, 0x0,  0x66, 0x0,  0x38, 0x18, 0x18, 0x18, 0x3c, 0x0,
-    0xc,  0x3e, 0xc,  0x7c, 0xcc, 0xcc, 0x78, 0x0,  0x76, 0xdc, 0x0,  0x7c,
-    0x66, 0x66, 0x66, 0x0,  0x70, 0x0,  0x3c, 0x66, 0x66, 0x66, 0x3c, 0x0,
-    0xe,  0x0,  0x3c, 0x66, 0x66, 0x66, 0x3c, 0x0,  0x18, 0x66, 0x0,  0x3c,
-    0x66, 0x66, 0x3c, 0x0,  0x76, 0xdc, 0x0,  0x3c, 0x66, 0x66, 0x3c, 0x0,
-    0x66, 0x0,  0x3c, 0x66, 0x66, 0x66, 0x3c, 0x0,  0x18, 0x18, 0x0,  0x7e,
-    0x0,  0x18, 0x18, 0x0,  0x0,  0x2,  0x7c, 0xce, 0xd6, 0xe6, 0x7c, 0x80,
-    0x70, 0x0,  0x66, 0x66, 0x66, 0x66, 0x3e, 0x0,  0xe,  0x0,  0x66, 0x66,
-    0x66, 0x66, 0x3e, 0x0,  0x18, 0x66, 0x0,  0x66, 0x66, 0x66, 0x3e, 0x0,
-    0x66, 0x0,  0x66, 0x66, 0x66, 0x66, 0x3e, 0x0,  0xe,  0x0,  0x66, 0x66,
-    0x66, 0x3e, 0x6,  0x3c, 0x60, 0x60, 0x7c, 0x66, 0x66, 0x7c, 0x60, 0x60,
-    0x66, 0x0,  0x66, 0x66, 0x66, 0x3e, 0x6,  0x3c};
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+extern const unsigned char DBGP_UNSCII8[1778];
+
+#ifdef DBGP_UNSCII8_IMPLEMENTATION
+const unsigned char DBGP_UNSCII8[1778] =
+    "\x44\x42\x47\x5a\x01\x08\x00\x00\x00\x01\x00\x00\x00\x00\x84\x01\x00\x06"
+    "\xe0\x80\xea\x2a\xee\x0a\x0a\x82\x08\x00\x00\xe4\x82\x08\x00\x01\xca\x8a"
+    "\x83\x08\x00\x04\xce\x84\xe4\x04\x04\x81\x08\x00\x02\x8a\xea\x0e\x80\x08"
+    "\x00\x03\xa0\xea\xaa\xac\x80\x28\x00\x06\xc0\xa0\xc8\xa8\xc8\x08\x0e\x80"
+    "\x08\x00\x0a\xce\xa8\xce\x02\x0e\x00\xa0\xa0\xee\xa4\xa4\x80\x28\x00\x06"
+    "\x80\x80\x8e\x88\xec\x08\x08\x80\x10\x00\x02\xae\xa4\x44\x83\x38\x00\x01"
+    "\x88\x8c\x80\x10\x00\x05\xe0\x80\x8e\x8a\xee\x0c\x81\x60\x00\x04\xee\x2a"
+    "\xea\x0a\x0e\x81\x08\x00\x02\x24\xe4\x04\x81\x40\x00\x00\xa8\x84\x48\x00"
+    "\x02\xa4\xac\xc4\x82\x10\x00\x02\xae\xa2\xce\x82\x58\x00\x02\xae\xa2\xc6"
+    "\x80\x58\x00\x06\xc0\xa0\xaa\xaa\xce\x02\x02\x80\x78\x00\x00\xaa\x82\x78"
+    "\x00\x82\xa8\x00\x82\x90\x00\x04\xcc\x8a\xec\x0a\x0c\x82\x58\x00\x00\xea"
+    "\x83\xb0\x00\x00\x8e\x81\x08\x00\x06\x3c\x66\x66\x30\x18\x00\x18\x82\x78"
+    "\x00\x00\xe8\x80\xa0\x00\x81\x80\x00\x00\x8e\x80\xa0\x00\x04\xe0\x80\xae"
+    "\xa8\xee\x81\x08\x00\x03\xa0\xee\xc8\xae\x82\xb0\x00\x83\x10\x00\x85\x00"
+    "\x01\x00\x18\x81\x01\x00\x80\x38\x00\x02\x66\x66\x66\x82\x13\x01\x02\x6c"
+    "\x6c\xfe\x80\x02\x00\x18\x6c\x00\x18\x3e\x60\x3c\x06\x7c\x18\x00\x00\xc6"
+    "\xcc\x18\x30\x66\xc6\x00\x38\x6c\x38\x76\xdc\xcc\x76\x80\x30\x00\x00\x30"
+    "\x82\x3b\x01\x07\x0c\x18\x30\x30\x30\x18\x0c\x00\x80\x04\x00\x00\x0c\x80"
+    "\x0c\x00\x05\x00\x00\x66\x3c\xff\x3c\x81\x43\x00\x02\x18\x18\x7e\x80\x51"
+    "\x00\x85\x5d\x00\x81\x2d\x00\x00\x7e\x88\x6d\x00\x02\x00\x03\x06\x80\x3a"
+    "\x00\x01\x60\xc0\x80\xb0\x00\x07\x6e\x76\x66\x66\x3c\x00\x18\x38\x81\x82"
+    "\x00\x00\x7e\x80\xc0\x00\x81\x18\x00\x81\x08\x00\x02\x06\x1c\x06\x80\x18"
+    "\x00\x0b\x1c\x3c\x6c\xcc\xfe\x0c\x0c\x00\x7e\x60\x7c\x06\x82\x10\x00\x02"
+    "\x30\x60\x7c\x81\x30\x00\x01\x7e\x06\x80\x41\x00\x80\xb2\x00\x80\xf0\x00"
+    "\x81\x03\x00\x81\xf8\x00\x03\x3e\x06\x0c\x38\x82\x5c\x00\x88\x04\x00\x00"
+    "\x30\x81\x66\x00\x81\xa0\x00\x81\x7f\x00\x81\x81\x00\x81\x0d\x00\x80\x79"
+    "\x00\x81\x60\x00\x00\x0c\x81\x28\x01\x08\x7c\xc6\xde\xde\xde\xc0\x7c\x00"
+    "\x18\x80\x39\x01\x00\x7e\x80\xfc\x00\x80\x5d\x00\x81\x03\x00\x80\x48\x01"
+    "\x02\x60\x60\x60\x80\x98\x00\x01\x78\x6c\x80\x12\x01\x01\x6c\x78\x80\x80"
+    "\x00\x02\x60\x7c\x60\x80\x98\x00\x83\x08\x00\x81\x40\x00\x01\x60\x6e\x80"
+    "\x73\x00\x81\x30\x01\x80\x37\x00\x01\x66\x00\x80\xed\x00\x82\xc0\x00\x00"
+    "\x06\x81\x01\x00\x80\xd0\x00\x07\xc6\xcc\xd8\xf0\xd8\xcc\xc6\x00\x80\x46"
+    "\x00\x80\x49\x00\x0e\x7e\x00\xc6\xee\xfe\xd6\xc6\xc6\xc6\x00\xc6\xe6\xf6"
+    "\xde\xce\x80\x08\x00\x80\xa8\x01\x80\x6b\x01\x00\x3c\x82\x70\x00\x83\x50"
+    "\x00\x81\x68\x00\x00\x36\x82\x80\x00\x80\x73\x00\x81\x80\x00\x00\x3c\x81"
+    "\x00\x01\x83\x58\x00\x82\x98\x01\x82\x30\x00\x83\x37\x00\x01\x18\x00\x80"
+    "\x4c\x00\x05\xd6\xfe\xee\xc6\x00\xc3\x80\x0d\x00\x02\x3c\x66\xc3\x82\x08"
+    "\x00\x81\xc2\x01\x00\x7e\x82\x58\x01\x80\x48\x01\x80\x97\x01\x04\x30\x30"
+    "\x3c\x00\xc0\x81\xfe\x00\x03\x06\x03\x00\x3c\x80\x9f\x01\x07\x0c\x0c\x3c"
+    "\x00\x10\x38\x6c\xc6\x86\xf5\x01\x02\x00\x00\xff\x80\x1d\x00\x84\xa5\x01"
+    "\x02\x3c\x06\x3e\x80\xd0\x00\x80\xe7\x00\x80\x03\x02\x00\x7c\x81\x10\x00"
+    "\x80\x01\x01\x00\x3c\x80\xd0\x00\x00\x3e\x80\x13\x02\x00\x3e\x81\x20\x00"
+    "\x01\x66\x7e\x80\x10\x00\x02\x1c\x30\x7c\x81\x5a\x00\x80\xe1\x01\x80\x18"
+    "\x00\x01\x3e\x06\x80\x14\x01\x81\x30\x00\x00\x66\x80\x72\x02\x81\xc1\x01"
+    "\x03\x1e\x00\x0c\x00\x82\x69\x00\x00\x78\x80\x3d\x01\x00\x6c\x80\x3c\x01"
+    "\x82\x16\x00\x81\x18\x00\x05\x00\x00\xcc\xfe\xd6\xd6\x81\x7b\x00\x83\x30"
+    "\x00\x81\x50\x00\x81\xf8\x01\x82\x10\x00\x80\x5a\x01\x84\x50\x00\x80\x8d"
+    "\x00\x00\x7c\x81\x7a\x01\x81\x60\x00\x81\x79\x02\x03\x00\x30\x30\x7e\x80"
+    "\x61\x02\x81\x40\x00\x81\x31\x01\x81\x88\x00\x83\x00\x01\x80\x91\x02\x03"
+    "\xc6\xd6\x7c\x6c\x81\x08\x00\x00\x6c\x83\xd3\x00\x81\xa7\x00\x00\x06\x80"
+    "\x51\x00\x00\x7e\x80\x93\x02\x08\x7e\x00\x0e\x18\x18\x70\x18\x18\x0e\x83"
+    "\xd8\x02\x80\xda\x02\x81\x0d\x00\x80\x13\x00\x02\x00\x76\xdc\x83\xfe\x00"
+    "\x80\x68\x03\x01\xa4\xc4\x81\xd8\x03\x02\xa0\xee\xaa\x82\x90\x03\x02\xa0"
+    "\xe4\xac\x81\x90\x03\x80\x20\x03\x01\xa2\xee\x81\x38\x03\x81\x08\x00\x81"
+    "\x38\x03\x02\x40\x4e\x4a\x82\x60\x03\x80\xa8\x03\x00\xa8\x82\x50\x03\x01"
+    "\xee\x28\x82\x48\x03\x80\xd8\x03\x81\x50\x03\x80\xf8\x03\x00\xa8\x83\x50"
+    "\x03\x02\xe2\xa2\xa2\x80\xd8\x03\x81\x58\x03\x00\x4e\x82\x68\x03\x02\xec"
+    "\x8a\x8a\x81\xa0\x03\x01\xa0\xea\x80\x08\x00\x82\x28\x04\x80\x20\x04\x82"
+    "\xf8\x03\x00\x22\x82\x60\x00\x80\x08\x00\x00\xe6\x82\xe0\x03\x00\xae\x82"
+    "\x48\x04\x80\x80\x00\x01\x8c\x84\x83\x80\x00\x01\x82\x8e\x84\x68\x00\x00"
+    "\xec\x82\xc0\x03\x00\x8e\x82\xc8\x03\x05\xa0\xe0\xea\xaa\xae\x0e\x83\x40"
+    "\x04\x00\xee\x82\x50\x04\x01\xce\x8a\x82\x08\x00\x00\xa0\x80\x10\x00\x82"
+    "\xc0\x00\x80\x18\x00\x83\xe0\x03\x84\xc8\x04\x00\x8e\x82\xa0\x00\x83\x68"
+    "\x04\x81\xb8\x04\x85\x00\x04\x02\xea\x8e\x8e\x82\xd0\x00\x02\xee\xaa\xae"
+    "\x80\xa8\x04\x85\x0c\x02\x80\x34\x04\x82\x02\x04\x05\x00\x18\x7e\xd8\xd8"
+    "\x7e\x80\xce\x01\x05\x6c\x60\xf0\x60\x66\xfc\x80\xcf\x03\x80\x60\x03\x80"
+    "\x2b\x02\x82\x68\x02\x81\x22\x04\x84\x04\x00\x01\x3c\x60\x81\x7a\x03\x00"
+    "\x06\x82\xeb\x03\x81\x40\x02\x0b\x7e\x81\x9d\xb1\xb1\x9d\x81\x7e\x3c\x6c"
+    "\x6c\x3e\x82\xea\x03\x04\x33\x66\xcc\x66\x33\x81\x19\x00\x81\xd4\x01\x82"
+    "\x74\x01\x81\xed\x01\x80\x28\x00\x05\xb9\xa5\xb9\xa5\x81\x7e\x85\x0d\x04"
+    "\x80\x5f\x00\x83\x80\x00\x82\x2f\x04\x00\x7e\x80\xa8\x01\x02\x30\x60\x78"
+    "\x80\xa1\x01\x03\x78\x0c\x18\x0c\x81\x08\x00\x82\x54\x04\x82\xa4\x00\x81"
+    "\x97\x02\x08\x60\xc0\x3e\x7a\x7a\x3a\x1a\x1a\x1a\x83\xb3\x00\x86\x01\x00"
+    "\x03\x08\x18\x30\x70\x83\x96\x02\x04\x38\x6c\x6c\x38\x00\x81\xbf\x02\x80"
+    "\x7e\x00\x0b\x66\xcc\x00\x00\x40\xc6\x4c\x5a\x36\x6a\xcf\x02\x80\x08\x00"
+    "\x00\x5e\x80\x93\x00\x05\x0f\xc0\x26\x6c\x3a\xf6\x80\x10\x00\x80\x24\x05"
+    "\x00\x30\x81\xe0\x03\x00\x70\x81\xd8\x02\x80\xf4\x04\x00\x0e\x84\x08\x00"
+    "\x00\x18\x81\x7b\x03\x01\x7e\x66\x81\x28\x02\x82\x08\x00\x83\x0f\x00\x80"
+    "\xe0\x02\x81\x6b\x04\x80\x18\x00\x00\x3f\x80\x8f\x04\x02\xcc\xcc\xcf\x85"
+    "\x20\x04\x80\x52\x02\x04\xfe\xc0\xf8\xc0\xfe\x80\x40\x00\x83\x08\x00\x80"
+    "\x40\x00\x01\xfe\xf0\x80\x10\x00\x80\x07\x00\x82\x18\x00\x00\x70\x82\x1a"
+    "\x04\x80\x90\x02\x84\x08\x00\x80\x60\x00\x80\x18\x05\x00\x7e\x80\x58\x00"
+    "\x83\x18\x00\x80\x60\x04\x00\xf6\x81\x60\x04\x80\x98\x02\x03\xc6\xf6\xde"
+    "\xc6\x80\x90\x00\x00\x7c\x80\x27\x04\x00\x7c\x80\x90\x00\x83\x08\x00\x80"
+    "\x90\x00\x80\x11\x00\x00\x7c\x81\xb8\x02\x82\x08\x00\x82\x0f\x00\x80\x20"
+    "\x00\x85\xf7\x02\x04\x3e\x66\x6e\x7e\x76\x80\xb0\x04\x00\x70\x81\x12\x04"
+    "\x82\x38\x00\x83\x08\x00\x80\xc8\x00\x82\x48\x00\x82\x07\x00\x82\x50\x00"
+    "\x81\x37\x04\x07\x18\x00\xc0\xc0\xfc\xc6\xfc\xc0\x81\x78\x05\x00\x66\x80"
+    "\xda\x04\x00\x6c\x81\x00\x01\x82\xf8\x03\x80\x00\x01\x82\x00\x04\x80\x00"
+    "\x01\x03\x3e\x66\xc6\x7e\x81\x28\x03\x82\x08\x00\x80\x8a\x04\x83\x18\x00"
+    "\x00\x18\x83\x18\x00\x80\xc7\x05\x03\x1b\x7f\xd8\x77\x81\xcf\x01\x81\x20"
+    "\x04\x80\x52\x03\x83\x18\x04\x82\x40\x01\x80\x30\x04\x81\x40\x01\x81\x28"
+    "\x04\x82\x47\x01\x80\x40\x04\x00\x70\x82\x18\x04\x81\x20\x00\x83\x08\x00"
+    "\x80\x60\x01\x80\xea\x05\x81\x20\x00\x83\x18\x00\x05\x0c\x3e\x0c\x7c\xcc"
+    "\xcc\x82\x00\x01\x81\x79\x04\x82\x90\x01\x81\x10\x06\x81\x90\x01\x82\x18"
+    "\x06\x81\x0b\x05\x80\x20\x06\x82\x90\x01\x81\x00\x05\x85\x18\x00\x81\x2d"
+    "\x02\x81\x61\x06\x07\x02\x7c\xce\xd6\xe6\x7c\x80\x70\x84\x20\x04\x81\xe8"
+    "\x00\x81\x98\x05\x80\xc8\x01\x82\xb8\x04\x82\x07\x00\x85\x18\x00\x80\x20"
+    "\x04\x82\xe0\x04\x80\xca\x05\x83\x1f\x00\x01\x06\x3c";
+#endif // DBGP_UNSCII8_IMPLEMENTATION
+
+#ifdef __cplusplus
+}
+#endif
 
 #endif // DBGP_UNSCII8_H
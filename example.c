@@ -1,7 +1,9 @@
 #include <SDL3/SDL.h>
 #include <SDL3/SDL_main.h>
 #include "SDL_DBGP.h"
+#define DBGP_UNSCII16_IMPLEMENTATION
 #include "SDL_DBGP_unscii16.h"
+#define DBGP_UNSCII8_IMPLEMENTATION
 #include "SDL_DBGP_unscii8.h"
 
 #define WIN_WIDTH 512
@@ -52,6 +54,14 @@ int main(void) {
     return 1;
   }
 
+  // both fonts share a texture, so that the text of a frame is batched
+  DBGP_FontGroup group;
+  if (!DBGP_CreateFontGroup(
+          &group, renderer, (DBGP_Font*[]){&unscii8, &unscii16}, 2)) {
+    SDL_Log("Unable to group fonts: %s", SDL_GetError());
+    return 1;
+  }
+
   SDL_SetRenderDrawBlendMode(renderer, SDL_BLENDMODE_BLEND);
 
   int should_quit = 0;
@@ -68,6 +78,7 @@ int main(void) {
         break;
       case SDL_EVENT_RENDER_TARGETS_RESET: {
         // in case of target reset, we must reload each font
+        DBGP_DestroyFontGroup(&group);
         DBGP_DestroyFont(&unscii8);
         if (!DBGP_CreateFont(
                 &unscii8, renderer, DBGP_UNSCII8, sizeof(DBGP_UNSCII8),
@@ -81,6 +92,11 @@ int main(void) {
                 DBGP_UNSCII16_HEIGHT)) {
           SDL_Log("Unable to initialise DBGP: %s", SDL_GetError());
         }
+
+        if (!DBGP_CreateFontGroup(
+                &group, renderer, (DBGP_Font*[]){&unscii8, &unscii16}, 2)) {
+          SDL_Log("Unable to group fonts: %s", SDL_GetError());
+        }
       } break;
       }
     }
@@ -88,6 +104,7 @@ int main(void) {
     SDL_SetRenderDrawColor(renderer, 0x30, 0x30, 0x30, 0xff);
     SDL_RenderClear(renderer);
 
+    DBGP_BeginBatch(renderer);
     DBGP_ColorPrint(
         &unscii16, renderer, 40 * 8, 0 * 16, 0x0f,
         "$00    $10    $20    $30    $40    $50    $60    $70");
@@ -137,12 +154,14 @@ int main(void) {
         "Qui hante la tempête et se rit de l'archer ;\n"
         "Exilé sur le sol au milieu des huées,\n"
         "Ses ailes de géant l'empêchent de marcher.");
+    DBGP_EndBatch(renderer);
 
     SDL_RenderPresent(renderer);
   }
 
   DBGP_DestroyFont(&unscii8);
   DBGP_DestroyFont(&unscii16);
+  DBGP_DestroyFontGroup(&group);
   SDL_DestroyRenderer(renderer);
   SDL_DestroyWindow(window);
   SDL_Quit();
@@ -0,0 +1,313 @@
+// Replays a trace written with DBGP_StartTrace on the software renderer (no
+// window needed), and reports the time spent drawing each frame.
+//
+// usage: SDL_DBGP-replay TRACE [-s WIDTHxHEIGHT] [-n RUNS] [-v]
+//
+// Traces only describe fonts by their glyph height: glyphs up to 8px high are
+// drawn with UNSCII-8, taller ones with UNSCII-16.
+#include <SDL3/SDL.h>
+#include <SDL3/SDL_main.h>
+#include "SDL_DBGP.h"
+#define DBGP_UNSCII16_IMPLEMENTATION
+#include "SDL_DBGP_unscii16.h"
+#define DBGP_UNSCII8_IMPLEMENTATION
+#include "SDL_DBGP_unscii8.h"
+
+#define MAX_FONTS 256
+
+typedef struct {
+  const Uint8* data;
+  size_t size;
+  size_t pos;
+  bool error;
+} reader;
+
+typedef struct {
+  DBGP_Font unscii8;
+  DBGP_Font unscii16;
+  DBGP_Font* fonts[MAX_FONTS]; // the font replaying each trace font id
+  char* str; // the last string read, NULL terminated
+  size_t str_capacity;
+  Uint64* frame_times; // in nanoseconds
+  int nb_frames;
+  int frames_capacity;
+  int nb_calls;
+} replay;
+
+static Uint8 read_byte(reader* r) {
+  if (r->pos >= r->size) {
+    r->error = true;
+    return 0;
+  }
+  return r->data[r->pos++];
+}
+
+static Uint64 read_uint(reader* r) {
+  Uint64 value = 0;
+  for (int shift = 0; shift < 64; shift += 7) {
+    const Uint8 byte = read_byte(r);
+    value |= (Uint64) (byte & 0x7f) << shift;
+    if ((byte & 0x80) == 0) {
+      return value;
+    }
+  }
+  r->error = true;
+  return 0;
+}
+
+static int read_int(reader* r) {
+  const Uint64 value = read_uint(r);
+  return (value & 1) ? (int) ~(value >> 1) : (int) (value >> 1);
+}
+
+static const char* read_string(reader* r, replay* rp) {
+  const Uint64 len = read_uint(r);
+  if (r->error || len > r->size - r->pos) {
+    r->error = true;
+    return "";
+  }
+  if (len + 1 > rp->str_capacity) {
+    char* str = SDL_realloc(rp->str, len + 1);
+    if (str == NULL) {
+      r->error = true;
+      return "";
+    }
+    rp->str = str;
+    rp->str_capacity = len + 1;
+  }
+  SDL_memcpy(rp->str, r->data + r->pos, len);
+  rp->str[len] = '\0';
+  r->pos += len;
+  return rp->str;
+}
+
+static DBGP_Font* read_font(reader* r, replay* rp) {
+  const Uint64 id = read_uint(r);
+  if (id >= MAX_FONTS || rp->fonts[id] == NULL) {
+    r->error = true;
+    return NULL;
+  }
+  return rp->fonts[id];
+}
+
+static bool add_frame_time(replay* rp, Uint64 time) {
+  if (rp->nb_frames == rp->frames_capacity) {
+    const int capacity = SDL_max(rp->frames_capacity * 2, 1024);
+    Uint64* times = SDL_realloc(rp->frame_times, capacity * sizeof(Uint64));
+    if (times == NULL) {
+      return false;
+    }
+    rp->frame_times = times;
+    rp->frames_capacity = capacity;
+  }
+  rp->frame_times[rp->nb_frames++] = time;
+  return true;
+}
+
+// Executes all the calls of a trace, timing each frame.
+static bool run_trace(
+    replay* rp, SDL_Renderer* renderer, const Uint8* data, size_t size,
+    bool verbose) {
+  reader r = {data, size, 0, false};
+  if (size < 5 || SDL_memcmp(data, "DBGT", 4) != 0) {
+    return SDL_SetError("Not a DBGP trace");
+  }
+  if (data[4] != DBGP_TRACE_VERSION) {
+    return SDL_SetError("Unsupported trace version %d", data[4]);
+  }
+  r.pos = 5;
+
+  SDL_SetRenderDrawColor(renderer, 0x30, 0x30, 0x30, 0xff);
+  SDL_RenderClear(renderer);
+  SDL_FlushRenderer(renderer);
+  Uint64 frame_start = SDL_GetTicksNS();
+  int frame_calls = 0;
+  while (r.pos < r.size && !r.error) {
+    const Uint8 type = read_byte(&r);
+    DBGP_Font* font = NULL;
+    SDL_Rect box = {0, 0, 0, 0};
+    SDL_Color colors[2];
+    Uint8 color = 0;
+    int flags = 0;
+
+    switch (type) {
+    case DBGP_TRACE_FONT: {
+      const Uint64 id = read_uint(&r);
+      const Uint64 glyph_height = read_uint(&r);
+      read_uint(&r); // number of glyphs
+      if (id >= MAX_FONTS) {
+        return SDL_SetError("Too many fonts in trace");
+      }
+      rp->fonts[id] = glyph_height <= 8 ? &rp->unscii8 : &rp->unscii16;
+    } break;
+
+    case DBGP_TRACE_PRINT:
+      font = read_font(&r, rp);
+      box.x = read_int(&r);
+      box.y = read_int(&r);
+      for (int i = 0; i < 2; i++) {
+        colors[i].r = read_byte(&r);
+        colors[i].g = read_byte(&r);
+        colors[i].b = read_byte(&r);
+        colors[i].a = read_byte(&r);
+      }
+      DBGP_Print(
+          font, renderer, box.x, box.y, colors[0], colors[1],
+          read_string(&r, rp));
+      frame_calls++;
+      break;
+
+    case DBGP_TRACE_COLOR_PRINT:
+      font = read_font(&r, rp);
+      box.x = read_int(&r);
+      box.y = read_int(&r);
+      color = read_byte(&r);
+      DBGP_ColorPrint(
+          font, renderer, box.x, box.y, color, read_string(&r, rp));
+      frame_calls++;
+      break;
+
+    case DBGP_TRACE_PRINT_WRAPPED:
+      font = read_font(&r, rp);
+      box.x = read_int(&r);
+      box.y = read_int(&r);
+      box.w = read_int(&r);
+      box.h = read_int(&r);
+      color = read_byte(&r);
+      flags = (int) read_uint(&r);
+      DBGP_PrintWrapped(
+          font, renderer, &box, color, flags, read_string(&r, rp));
+      frame_calls++;
+      break;
+
+    case DBGP_TRACE_FRAME: {
+      // rendering is deferred until the command queue is flushed
+      SDL_FlushRenderer(renderer);
+      const Uint64 time = SDL_GetTicksNS() - frame_start;
+      if (verbose) {
+        SDL_Log(
+            "frame %d: %.3f ms, %d calls", rp->nb_frames, time / 1e6,
+            frame_calls);
+      }
+      if (!add_frame_time(rp, time)) {
+        return false;
+      }
+      rp->nb_calls += frame_calls;
+      frame_calls = 0;
+      DBGP_ResetFrameArena();
+      SDL_RenderClear(renderer);
+      SDL_FlushRenderer(renderer);
+      frame_start = SDL_GetTicksNS();
+    } break;
+
+    default: return SDL_SetError("Unknown record %d in trace", type);
+    }
+  }
+  if (r.error) {
+    return SDL_SetError("Truncated or invalid trace");
+  }
+  return true;
+}
+
+// Prints the statistics of the frame times, using a performance HUD.
+static bool report(const replay* rp, const char* filename, int runs) {
+  DBGP_PerfHUD hud;
+  DBGP_PerfStats stats;
+  if (!DBGP_CreatePerfHUD(&hud, rp->nb_frames, 1, 1)) {
+    return false;
+  }
+  const int series = DBGP_AddPerfSeries(&hud, "frame", DBGP_DEFAULT_COLORS);
+  for (int i = 0; i < rp->nb_frames; i++) {
+    DBGP_AddPerfSample(&hud, series, rp->frame_times[i] / 1e6f);
+  }
+  const bool result = DBGP_GetPerfStats(&hud, series, &stats);
+  DBGP_DestroyPerfHUD(&hud);
+  if (!result) {
+    return false;
+  }
+
+  SDL_Log(
+      "%s: %d frames (%d runs), %d calls", filename, rp->nb_frames, runs,
+      rp->nb_calls);
+  SDL_Log(
+      "frame time (ms): min %.3f avg %.3f max %.3f p50 %.3f p95 %.3f "
+      "p99 %.3f",
+      stats.min, stats.avg, stats.max, stats.p50, stats.p95, stats.p99);
+  return true;
+}
+
+int main(int argc, char* argv[]) {
+  const char* filename = NULL;
+  int width = 1280;
+  int height = 720;
+  int runs = 1;
+  bool verbose = false;
+  for (int i = 1; i < argc; i++) {
+    if (SDL_strcmp(argv[i], "-s") == 0 && i + 1 < argc) {
+      if (SDL_sscanf(argv[++i], "%dx%d", &width, &height) != 2) {
+        SDL_Log("Invalid size: %s", argv[i]);
+        return 1;
+      }
+    } else if (SDL_strcmp(argv[i], "-n") == 0 && i + 1 < argc) {
+      runs = SDL_atoi(argv[++i]);
+      runs = SDL_max(runs, 1);
+    } else if (SDL_strcmp(argv[i], "-v") == 0) {
+      verbose = true;
+    } else {
+      filename = argv[i];
+    }
+  }
+  if (filename == NULL) {
+    SDL_Log("usage: %s TRACE [-s WIDTHxHEIGHT] [-n RUNS] [-v]", argv[0]);
+    return 1;
+  }
+
+  size_t size = 0;
+  Uint8* data = SDL_LoadFile(filename, &size);
+  if (data == NULL) {
+    SDL_Log("Unable to load trace: %s", SDL_GetError());
+    return 1;
+  }
+  SDL_Surface* surface =
+      SDL_CreateSurface(width, height, SDL_PIXELFORMAT_ARGB8888);
+  SDL_Renderer* renderer =
+      surface != NULL ? SDL_CreateSoftwareRenderer(surface) : NULL;
+  if (renderer == NULL) {
+    SDL_Log("Unable to create software renderer: %s", SDL_GetError());
+    return 1;
+  }
+  SDL_SetRenderDrawBlendMode(renderer, SDL_BLENDMODE_BLEND);
+
+  replay rp;
+  SDL_memset(&rp, 0, sizeof(rp));
+  if (!DBGP_CreateFont(
+          &rp.unscii8, renderer, DBGP_UNSCII8, sizeof(DBGP_UNSCII8),
+          DBGP_UNSCII8_HEIGHT) ||
+      !DBGP_CreateFont(
+          &rp.unscii16, renderer, DBGP_UNSCII16, sizeof(DBGP_UNSCII16),
+          DBGP_UNSCII16_HEIGHT)) {
+    SDL_Log("Unable to initialise fonts: %s", SDL_GetError());
+    return 1;
+  }
+
+  int status = 0;
+  for (int run = 0; run < runs && status == 0; run++) {
+    if (!run_trace(&rp, renderer, data, size, verbose)) {
+      SDL_Log("Unable to replay %s: %s", filename, SDL_GetError());
+      status = 1;
+    }
+  }
+  if (status == 0 && rp.nb_frames > 0 && !report(&rp, filename, runs)) {
+    SDL_Log("Unable to compute statistics: %s", SDL_GetError());
+    status = 1;
+  }
+
+  SDL_free(rp.frame_times);
+  SDL_free(rp.str);
+  DBGP_DestroyFont(&rp.unscii8);
+  DBGP_DestroyFont(&rp.unscii16);
+  SDL_DestroyRenderer(renderer);
+  SDL_DestroySurface(surface);
+  SDL_free(data);
+  return status;
+}
@@ -0,0 +1,639 @@
+// Regression tests: draws a corpus of strings with the software renderer of
+// the offscreen video driver, and checks that the pixels read back match
+// golden hashes, that they are identical to the pixels drawn on the CPU by
+// DBGP_ColorPrintToSurface, that no memory is allocated in steady state, and
+// that each scenario is drawn within its time budget. ANSI streams are
+// checked against the equivalent color escapes, with a throughput floor.
+//
+// usage: SDL_DBGP-test [--update]
+//
+// --update prints the hashes of the current output and the time per frame,
+// to paste in scenarios after an intended change, along with the version of
+// SDL that produced them (to state when committing them). A golden hash or
+// budget of 0 has not been recorded yet, and fails. Time budgets are scaled
+// by the DBGP_TEST_BUDGET_SCALE environment variable (0 disables them).
+#include <SDL3/SDL.h>
+#include <SDL3/SDL_main.h>
+#include "SDL_DBGP.h"
+#define DBGP_UNSCII16_IMPLEMENTATION
+#include "SDL_DBGP_unscii16.h"
+#define DBGP_UNSCII8_IMPLEMENTATION
+#include "SDL_DBGP_unscii8.h"
+
+#define SCREEN_WIDTH 640
+#define SCREEN_HEIGHT 400
+#define TIMED_FRAMES 100
+
+typedef enum {
+  CORPUS_LATIN1, // every Latin-1 glyph a string can hold, with DBGP_Print
+  CORPUS_COLORS, // every color escape
+  CORPUS_SCREEN, // a full screen of text
+  CORPUS_STRING, // the string of the scenario
+} corpus;
+
+typedef struct {
+  const char* name;
+  int font; // 8 or 16, the height of the UNSCII font
+  corpus corpus;
+  const char* str;
+  Uint64 golden; // FNV-1a hash of the ARGB pixels (0: not recorded)
+  int budget_us; // time budget of a frame drawing the scenario (0: not
+                 // recorded)
+} scenario;
+
+// The goldens and budgets are recorded with --update on a SDL3 build; they
+// are 0, and the scenarios fail, until then.
+static const scenario scenarios[] = {
+    {"latin1-unscii8", 8, CORPUS_LATIN1, NULL, 0, 0},
+    {"latin1-unscii16", 16, CORPUS_LATIN1, NULL, 0, 0},
+    {"colors-unscii8", 8, CORPUS_COLORS, NULL, 0, 0},
+    {"colors-unscii16", 16, CORPUS_COLORS, NULL, 0, 0},
+    {"screen-unscii16", 16, CORPUS_SCREEN, NULL, 0, 0},
+    {"newlines", 8, CORPUS_STRING,
+     "first line\nsecond line\n\n\nafter empty lines\n   indented\n\n", 0, 0},
+    {"invalid-utf8", 16, CORPUS_STRING,
+     "bad lead \xff\xfe, truncated \xc3 \xe2\x82 \xf0\x9f\x98, "
+     "overlong \xc0\xaf \xe0\x80\xaf, lone \x80\xbf, ok \xc3\xa9\xc2\xbd",
+     0, 0},
+    {"escapes", 8, CORPUS_STRING,
+     "$1fheader$0f$G0,2;cell (0, 2)$G30,2;$4ecell (30, 2)$0f"
+     "$P100,50;pixel (100, 50)$M-16,12;moved\n"
+     "$*40;=\na\tb\tc\n$2f$*3; $0ftab\tstop", 0, 0},
+    {"malformed-escapes", 16, CORPUS_STRING,
+     "$ $g $1 $1g $G1; $G1,2 $P$M-,1; $*; $*3 $", 0, 0},
+    {"cjk", 16, CORPUS_STRING,
+     "\xe6\x97\xa5\xe6\x9c\xac\xe8\xaa\x9e text\n"
+     "$1f\xe6\xbc\xa2\xe5\xad\x97$0f \xe3\x81\x8b\xe3\x81\xaa|\n"
+     "fullwidth \xef\xbc\xa1\xef\xbc\xa2\xef\xbc\xa3|\n"
+     "\xea\xb0\x80\xeb\x82\x98\xeb\x8b\xa4\t|",
+     0, 0},
+    {"combining-marks", 16, CORPUS_STRING,
+     "e\xcc\x81 a\xcc\x80\xcc\x82 n\xcc\x83|\n"
+     "\xcc\x81line start$1f e\xcc\x81 $0f\n"
+     "$G3,3;\xcc\x81moved\t\xcc\x81tab\n"
+     "\xe6\x97\xa5\xcc\x81 wide \xef\xbc\xa1\xcc\x82\xcc\x83|",
+     0, 0},
+};
+
+// UNSCII has no combining marks: the unscii16 fallback font gives visible
+// glyphs to U+0300-U+0303, so that misplaced marks change the pixels.
+static const char marks_hex[] =
+    "0300:FF000000000000000000000000000000\n"
+    "0301:FFFF0000000000000000000000000000\n"
+    "0302:FFFFFF00000000000000000000000000\n"
+    "0303:FFFFFFFF000000000000000000000000\n";
+
+// A font missing "B" between "A" and "C", which must be drawn with its
+// fallback font.
+static const char gapped_hex[] =
+    "0041:FFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFF\n"
+    "0043:FFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFF\n";
+
+// Pairs of strings that must be drawn identically with DBGP_ColorPrint.
+static const struct {
+  const char* name;
+  const char* str;
+  const char* same_as;
+} equivalences[] = {
+    // combining marks without a previous cell on their line are skipped
+    {"combining-text-start", "\xcc\x81\xcc\x82x", "x"},
+    {"combining-line-start", "a\n\xcc\x81" "b", "a\nb"},
+    // wide codepoints take two cells
+    {"cjk-advance", "\xe6\x97\xa5x\xef\xbc\xa1y",
+     "\xe6\x97\xa5$G2,0;x\xef\xbc\xa1$G5,0;y"},
+    // combining marks are drawn at the start of a wide codepoint (over an
+    // invisible space in same_as)
+    {"combining-after-wide", "\xe6\x97\xa5\xcc\x81x",
+     "\xe6\x97\xa5$G0,0; \xcc\x81$G2,0;x"},
+};
+
+// Builds the text of a scenario in buf, returning the colors it starts with
+// (or -1 for DBGP_Print).
+static int build_text(const scenario* s, char* buf, size_t size) {
+  char* ptr = buf;
+  switch (s->corpus) {
+  case CORPUS_LATIN1:
+    // glyphs 0 (end of string) and 10 (newline) can't be printed
+    for (Uint32 cp = 1; cp < 256; cp++) {
+      if (cp != '\n') {
+        ptr = SDL_UCS4ToUTF8(cp, ptr);
+      }
+      if (cp % 32 == 31) {
+        *ptr++ = '\n';
+      }
+    }
+    *ptr = '\0';
+    return -1;
+
+  case CORPUS_COLORS:
+    for (int colors = 0; colors < 256; colors++) {
+      ptr += SDL_snprintf(
+          ptr, size - (ptr - buf), "$%02x%02X%s", colors, colors,
+          colors % 16 == 15 ? "\n" : " ");
+    }
+    return DBGP_DEFAULT_COLORS;
+
+  case CORPUS_SCREEN:
+    for (int row = 0; row < 25; row++) {
+      ptr += SDL_snprintf(
+          ptr, size - (ptr - buf), "$%x%x", row % 8, 15 - row % 8);
+      for (int col = 0; col < 80; col++) {
+        *ptr++ = (char) ('!' + (row * 80 + col) % 94);
+      }
+      *ptr++ = '\n';
+    }
+    *ptr = '\0';
+    return DBGP_DEFAULT_COLORS;
+
+  default: SDL_strlcpy(buf, s->str, size); return DBGP_DEFAULT_COLORS;
+  }
+}
+
+static const SDL_Color print_bg = {0x00, 0x00, 0xaa, 0xff};
+static const SDL_Color print_fg = {0xff, 0xff, 0x55, 0xff};
+static const SDL_Color clear_color = {0x30, 0x30, 0x30, 0xff};
+
+static bool draw_text(
+    DBGP_Font* font, SDL_Renderer* renderer, const char* text, int colors) {
+  return colors < 0 ? DBGP_Print(font, renderer, 4, 4, print_bg, print_fg, text)
+                    : DBGP_ColorPrint(font, renderer, 4, 4, colors, text);
+}
+
+// FNV-1a over the ARGB bytes of the pixels.
+static Uint64 hash_surface(SDL_Surface* surface) {
+  SDL_Surface* argb = SDL_ConvertSurface(surface, SDL_PIXELFORMAT_ARGB8888);
+  if (argb == NULL) {
+    return 0;
+  }
+  Uint64 hash = 0xcbf29ce484222325ull;
+  for (int y = 0; y < argb->h; y++) {
+    const Uint32* row =
+        (const Uint32*) ((const Uint8*) argb->pixels + y * argb->pitch);
+    for (int x = 0; x < argb->w; x++) {
+      for (int shift = 24; shift >= 0; shift -= 8) {
+        hash = (hash ^ ((row[x] >> shift) & 0xff)) * 0x100000001b3ull;
+      }
+    }
+  }
+  SDL_DestroySurface(argb);
+  return hash;
+}
+
+static Uint64 render_hash(
+    DBGP_Font* font, SDL_Renderer* renderer, const char* text, int colors) {
+  SDL_SetRenderDrawColor(
+      renderer, clear_color.r, clear_color.g, clear_color.b, clear_color.a);
+  SDL_RenderClear(renderer);
+  if (!draw_text(font, renderer, text, colors)) {
+    return 0;
+  }
+  SDL_Surface* pixels = SDL_RenderReadPixels(renderer, NULL);
+  if (pixels == NULL) {
+    return 0;
+  }
+  const Uint64 hash = hash_surface(pixels);
+  SDL_DestroySurface(pixels);
+  return hash;
+}
+
+static Uint64 surface_hash(DBGP_Font* font, const char* text, int colors) {
+  SDL_Surface* surface =
+      SDL_CreateSurface(SCREEN_WIDTH, SCREEN_HEIGHT, SDL_PIXELFORMAT_ARGB8888);
+  if (surface == NULL) {
+    return 0;
+  }
+  SDL_FillSurfaceRect(
+      surface, NULL,
+      SDL_MapSurfaceRGBA(
+          surface, clear_color.r, clear_color.g, clear_color.b,
+          clear_color.a));
+  const bool result =
+      colors < 0
+          ? DBGP_PrintToSurface(font, surface, 4, 4, print_bg, print_fg, text)
+          : DBGP_ColorPrintToSurface(font, surface, 4, 4, colors, text);
+  const Uint64 hash = result ? hash_surface(surface) : 0;
+  SDL_DestroySurface(surface);
+  return hash;
+}
+
+// Returns the average time in microseconds to draw a frame of a scenario.
+static double time_frames(
+    DBGP_Font* font, SDL_Renderer* renderer, const char* text, int colors) {
+  const Uint64 start = SDL_GetTicksNS();
+  for (int i = 0; i < TIMED_FRAMES; i++) {
+    SDL_RenderClear(renderer);
+    draw_text(font, renderer, text, colors);
+    // rendering is deferred until the command queue is flushed
+    SDL_FlushRenderer(renderer);
+    DBGP_ResetFrameArena();
+  }
+  return (SDL_GetTicksNS() - start) / 1e3 / TIMED_FRAMES;
+}
+
+// Counts the allocations made by DBGP, to check that drawing doesn't
+// allocate once the frame arena has grown.
+static int nb_allocations = 0;
+
+static void* SDLCALL count_malloc(void* userdata, size_t size) {
+  (void) userdata;
+  nb_allocations++;
+  return SDL_malloc(size);
+}
+
+static void* SDLCALL count_realloc(void* userdata, void* mem, size_t size) {
+  (void) userdata;
+  nb_allocations++;
+  return SDL_realloc(mem, size);
+}
+
+static void SDLCALL count_free(void* userdata, void* mem) {
+  (void) userdata;
+  SDL_free(mem);
+}
+
+// Checks that the codepoints missing from a font are drawn with its fallback.
+static int test_fallbacks(DBGP_Font* fallback, SDL_Renderer* renderer) {
+  DBGP_Font gapped;
+  DBGP_Font* const fallbacks[] = {fallback};
+  if (!DBGP_CreateFontFromHex(
+          &gapped, renderer,
+          SDL_IOFromConstMem(gapped_hex, sizeof(gapped_hex) - 1), true,
+          fallback->glyph_height) ||
+      !DBGP_SetFontFallbacks(&gapped, fallbacks, 1)) {
+    SDL_Log("FAIL fallbacks: %s", SDL_GetError());
+    return 1;
+  }
+  const Uint64 hash = render_hash(&gapped, renderer, "B", DBGP_DEFAULT_COLORS);
+  const Uint64 expected =
+      render_hash(fallback, renderer, "B", DBGP_DEFAULT_COLORS);
+  DBGP_DestroyFont(&gapped);
+  if (hash == 0 || hash != expected) {
+    SDL_Log("FAIL fallbacks: a missing glyph isn't drawn with the fallback");
+    return 1;
+  }
+  SDL_Log("ok fallbacks");
+  return 0;
+}
+
+// A log for the DBGP_TextView test: it ends without a newline, some lines end
+// with "\r\n", and it is followed by bytes that must never be read.
+#define VIEW_LINES 200
+static const char* const view_messages[] = {
+    "ok", "error: disk full", "warning: error rate high", "errand done\r",
+    "an error, then another error"};
+static char view_text[VIEW_LINES * 40];
+static int view_line_starts[VIEW_LINES + 1];
+
+static size_t build_view_text(void) {
+  char* ptr = view_text;
+  for (int line = 0; line < VIEW_LINES; line++) {
+    view_line_starts[line] = (int) (ptr - view_text);
+    ptr += SDL_snprintf(
+        ptr, sizeof(view_text) - (ptr - view_text), "%03d %s%s", line,
+        view_messages[line % SDL_arraysize(view_messages)],
+        line < VIEW_LINES - 1 ? "\n" : "");
+  }
+  view_line_starts[VIEW_LINES] = (int) (ptr - view_text) + 1;
+  const size_t length = ptr - view_text;
+  SDL_strlcpy(ptr, " error", sizeof(view_text) - length);
+  return length;
+}
+
+// Copies a line of the log in buf, without its line end.
+static void get_view_line(int line, char* buf, size_t size) {
+  const int start = view_line_starts[line];
+  int len = view_line_starts[line + 1] - 1 - start;
+  if (len > 0 && view_text[start + len - 1] == '\r') {
+    len--;
+  }
+  SDL_strlcpy(buf, view_text + start, SDL_min((size_t) len + 1, size));
+}
+
+// Checks the matching lines of a text view against SDL_strstr.
+static bool check_view_matches(const DBGP_TextView* view, const char* filter) {
+  int nb_matches = 0;
+  for (int line = 0; line < VIEW_LINES; line++) {
+    char buf[64];
+    get_view_line(line, buf, sizeof(buf));
+    if (SDL_strstr(buf, filter) != NULL) {
+      if (nb_matches >= view->nb_matches ||
+          view->matches[nb_matches] != line) {
+        return false;
+      }
+      nb_matches++;
+    }
+  }
+  return nb_matches == view->nb_matches;
+}
+
+// Builds the color escapes string drawing the same lines as a text view, with
+// the occurrences of the filter highlighted.
+static void build_view_reference(
+    const DBGP_TextView* view, const char* filter, int first, int nb_visible,
+    char* buf, size_t size) {
+  const size_t len = SDL_strlen(filter);
+  char* ptr = buf;
+  *ptr = '\0';
+  for (int i = 0; i < nb_visible && first + i < view->nb_matches; i++) {
+    char line[64];
+    get_view_line(view->matches[first + i], line, sizeof(line));
+    const char* p = line;
+    const char* match;
+    while (len > 0 && (match = SDL_strstr(p, filter)) != NULL) {
+      ptr += SDL_snprintf(
+          ptr, size - (ptr - buf), "$%02x%.*s$%02x%s", view->colors,
+          (int) (match - p), p, view->highlight_colors, filter);
+      p = match + len;
+    }
+    ptr += SDL_snprintf(ptr, size - (ptr - buf), "$%02x%s\n", view->colors, p);
+  }
+}
+
+// Filters a text view with a sequence of filters (full scans, and
+// refinements when the filter only grows), and checks the matching lines and
+// that they are drawn like the same text printed with color escapes.
+static int test_text_view(DBGP_Font* font, SDL_Renderer* renderer) {
+  static const char* const filters[] = {
+      "err", "erro", "error", "error,", "rr", "", "ate", "none"};
+  static const SDL_Rect box = {4, 4, 600, 160};
+  const int first = 2;
+  DBGP_TextView view;
+  if (!DBGP_CreateTextView(&view, font, 0x07, 0x4e) ||
+      !DBGP_SetTextViewText(&view, view_text, build_view_text())) {
+    SDL_Log("FAIL text-view: %s", SDL_GetError());
+    return 1;
+  }
+
+  int failures = 0;
+  for (size_t i = 0; i < SDL_arraysize(filters); i++) {
+    if (!DBGP_FilterTextView(&view, filters[i]) ||
+        !check_view_matches(&view, filters[i])) {
+      SDL_Log("FAIL text-view: wrong lines matching \"%s\"", filters[i]);
+      failures++;
+      continue;
+    }
+
+    SDL_RenderClear(renderer);
+    DBGP_RenderTextView(&view, renderer, &box, first);
+    SDL_Surface* pixels = SDL_RenderReadPixels(renderer, NULL);
+    const Uint64 hash = pixels != NULL ? hash_surface(pixels) : 0;
+    SDL_DestroySurface(pixels);
+
+    static char reference[4096];
+    build_view_reference(
+        &view, filters[i], first, box.h / font->glyph_height, reference,
+        sizeof(reference));
+    const Uint64 reference_hash = render_hash(font, renderer, reference, 0x07);
+    if (hash == 0 || hash != reference_hash) {
+      SDL_Log(
+          "FAIL text-view: \"%s\" drawn differently from color escapes",
+          filters[i]);
+      failures++;
+    } else {
+      SDL_Log(
+          "ok text-view: \"%s\" matches %d lines", filters[i],
+          view.nb_matches);
+    }
+  }
+  DBGP_DestroyTextView(&view);
+  return failures;
+}
+
+// ANSI streams must draw like the equivalent color escapes, with and without
+// fallback fonts (runs of ASCII characters take a faster path).
+static const char ansi_text[] =
+    "plain \x1b[31mred\x1b[44m on blue\x1b[0m\r\n"
+    "\x1b[1;32mbright\x1b[7m reverse\x1b[0m e\xcc\x81 \xe6\x97\xa5|";
+static const char ansi_same_as[] =
+    "plain $04red$14 on blue$0f\n"
+    "$0abright$a0 reverse$0f e\xcc\x81 \xe6\x97\xa5|";
+
+// Parsing and queuing ANSI streams of colored ASCII text must stay above
+// this throughput (divided by DBGP_TEST_BUDGET_SCALE): a loose floor, that
+// catches gross regressions such as a flush or an allocation per glyph.
+#define ANSI_MIN_MB_PER_S 5.0
+#define ANSI_SCREEN_LINES 25
+
+static Uint64 ansi_hash(
+    DBGP_Font* font, SDL_Renderer* renderer, const char* text) {
+  SDL_SetRenderDrawColor(
+      renderer, clear_color.r, clear_color.g, clear_color.b, clear_color.a);
+  SDL_RenderClear(renderer);
+  DBGP_ANSIStream stream;
+  DBGP_InitANSIStream(&stream, font, 4, 4, DBGP_DEFAULT_COLORS);
+  if (!DBGP_WriteANSI(&stream, renderer, text, SDL_strlen(text))) {
+    return 0;
+  }
+  SDL_Surface* pixels = SDL_RenderReadPixels(renderer, NULL);
+  if (pixels == NULL) {
+    return 0;
+  }
+  const Uint64 hash = hash_surface(pixels);
+  SDL_DestroySurface(pixels);
+  return hash;
+}
+
+static int test_ansi(
+    DBGP_Font* font, DBGP_Font* fallback_font, SDL_Renderer* renderer,
+    double budget_scale) {
+  int failures = 0;
+  DBGP_Font* const fonts[] = {font, fallback_font};
+  for (size_t i = 0; i < SDL_arraysize(fonts); i++) {
+    const Uint64 hash = ansi_hash(fonts[i], renderer, ansi_text);
+    const Uint64 expected =
+        render_hash(fonts[i], renderer, ansi_same_as, DBGP_DEFAULT_COLORS);
+    if (hash == 0 || hash != expected) {
+      SDL_Log(
+          "FAIL ansi: drawn differently from color escapes (%d px font)",
+          fonts[i]->glyph_height);
+      failures++;
+    }
+  }
+
+  // a screen of colored ASCII lines, redrawn from the top left corner; only
+  // DBGP_WriteANSI is timed, not the rendering of the queued glyphs
+  static char screen[ANSI_SCREEN_LINES * 96];
+  char* ptr = screen;
+  ptr += SDL_snprintf(ptr, sizeof(screen), "\x1b[H");
+  for (int row = 0; row < ANSI_SCREEN_LINES; row++) {
+    ptr += SDL_snprintf(
+        ptr, sizeof(screen) - (ptr - screen), "\x1b[%d;%dm", 30 + row % 8,
+        40 + (row + 4) % 8);
+    for (int col = 0; col < 79; col++) {
+      *ptr++ = (char) ('!' + (row * 79 + col) % 94);
+    }
+    *ptr++ = '\r';
+    *ptr++ = '\n';
+  }
+  const size_t len = ptr - screen;
+  DBGP_ANSIStream stream;
+  DBGP_InitANSIStream(&stream, font, 0, 0, DBGP_DEFAULT_COLORS);
+  Uint64 elapsed = 0;
+  for (int i = 0; i < TIMED_FRAMES; i++) {
+    const Uint64 start = SDL_GetTicksNS();
+    DBGP_WriteANSI(&stream, renderer, screen, len);
+    elapsed += SDL_GetTicksNS() - start;
+    SDL_FlushRenderer(renderer);
+    DBGP_ResetFrameArena();
+  }
+  const double mb_per_s =
+      (double) len * TIMED_FRAMES / 1e6 / (SDL_max(elapsed, 1) / 1e9);
+  if (budget_scale > 0 && mb_per_s < ANSI_MIN_MB_PER_S / budget_scale) {
+    SDL_Log(
+        "FAIL ansi: %.1f MB/s, minimum %.1f MB/s", mb_per_s,
+        ANSI_MIN_MB_PER_S / budget_scale);
+    failures++;
+  } else if (failures == 0) {
+    SDL_Log("ok ansi: %.1f MB/s", mb_per_s);
+  }
+  return failures;
+}
+
+int main(int argc, char* argv[]) {
+  const bool update = argc > 1 && SDL_strcmp(argv[1], "--update") == 0;
+  const char* scale_env = SDL_getenv("DBGP_TEST_BUDGET_SCALE");
+  const double budget_scale = scale_env != NULL ? SDL_atof(scale_env) : 1.0;
+
+  DBGP_SetAllocator(count_malloc, count_realloc, count_free, NULL);
+  SDL_SetHint(SDL_HINT_VIDEO_DRIVER, "offscreen");
+  if (!SDL_Init(SDL_INIT_VIDEO)) {
+    SDL_Log("Unable to initialise SDL3: %s", SDL_GetError());
+    return 1;
+  }
+  SDL_Window* window =
+      SDL_CreateWindow("SDL_DBGP-test", SCREEN_WIDTH, SCREEN_HEIGHT, 0);
+  SDL_Renderer* renderer =
+      window != NULL ? SDL_CreateRenderer(window, SDL_SOFTWARE_RENDERER)
+                     : NULL;
+  if (renderer == NULL) {
+    SDL_Log("Unable to create software renderer: %s", SDL_GetError());
+    return 1;
+  }
+  if (update) {
+    const int version = SDL_GetVersion();
+    SDL_Log(
+        "SDL %d.%d.%d (%s), renderer %s", SDL_VERSIONNUM_MAJOR(version),
+        SDL_VERSIONNUM_MINOR(version), SDL_VERSIONNUM_MICRO(version),
+        SDL_GetRevision(), SDL_GetRendererName(renderer));
+  }
+
+  DBGP_Font unscii8;
+  DBGP_Font unscii16;
+  if (!DBGP_CreateFont(
+          &unscii8, renderer, DBGP_UNSCII8, sizeof(DBGP_UNSCII8),
+          DBGP_UNSCII8_HEIGHT) ||
+      !DBGP_CreateFont(
+          &unscii16, renderer, DBGP_UNSCII16, sizeof(DBGP_UNSCII16),
+          DBGP_UNSCII16_HEIGHT)) {
+    SDL_Log("Unable to initialise fonts: %s", SDL_GetError());
+    return 1;
+  }
+  DBGP_Font marks;
+  DBGP_Font* const fallbacks[] = {&marks};
+  if (!DBGP_CreateFontFromHex(
+          &marks, renderer,
+          SDL_IOFromConstMem(marks_hex, sizeof(marks_hex) - 1), true,
+          DBGP_UNSCII16_HEIGHT) ||
+      !DBGP_SetFontFallbacks(&unscii16, fallbacks, 1)) {
+    SDL_Log("Unable to initialise fallback font: %s", SDL_GetError());
+    return 1;
+  }
+
+  static char texts[SDL_arraysize(scenarios)][8192];
+  int colors[SDL_arraysize(scenarios)];
+  int failures = 0;
+  for (size_t i = 0; i < SDL_arraysize(scenarios); i++) {
+    const scenario* s = &scenarios[i];
+    DBGP_Font* font = s->font == 8 ? &unscii8 : &unscii16;
+    colors[i] = build_text(s, texts[i], sizeof(texts[i]));
+
+    const Uint64 hash = render_hash(font, renderer, texts[i], colors[i]);
+    if (update) {
+      const double us = time_frames(font, renderer, texts[i], colors[i]);
+      SDL_Log(
+          "%s: 0x%016" SDL_PRIx64 "ull, %.1f us per frame", s->name, hash, us);
+      continue;
+    }
+    const int scenario_failures = failures;
+    if (s->golden == 0) {
+      SDL_Log("FAIL %s: no golden hash recorded (see --update)", s->name);
+      failures++;
+    } else if (hash != s->golden) {
+      SDL_Log(
+          "FAIL %s: hash 0x%016" SDL_PRIx64 ", expected 0x%016" SDL_PRIx64,
+          s->name, hash, s->golden);
+      failures++;
+    }
+    const Uint64 reference = surface_hash(font, texts[i], colors[i]);
+    if (reference != hash) {
+      SDL_Log(
+          "FAIL %s: surface hash 0x%016" SDL_PRIx64 " differs from renderer",
+          s->name, reference);
+      failures++;
+    }
+
+    const double us = time_frames(font, renderer, texts[i], colors[i]);
+    if (budget_scale > 0 && s->budget_us == 0) {
+      SDL_Log("FAIL %s: no time budget recorded (see --update)", s->name);
+      failures++;
+    } else if (budget_scale > 0 && us > s->budget_us * budget_scale) {
+      SDL_Log(
+          "FAIL %s: %.1f us per frame, budget %.1f us", s->name, us,
+          s->budget_us * budget_scale);
+      failures++;
+    }
+    if (failures == scenario_failures) {
+      SDL_Log("ok %s: %.1f us per frame", s->name, us);
+    }
+  }
+
+  if (!update) {
+    for (size_t i = 0; i < SDL_arraysize(equivalences); i++) {
+      const Uint64 hash = render_hash(
+          &unscii16, renderer, equivalences[i].str, DBGP_DEFAULT_COLORS);
+      const Uint64 expected = render_hash(
+          &unscii16, renderer, equivalences[i].same_as, DBGP_DEFAULT_COLORS);
+      if (hash == 0 || hash != expected) {
+        SDL_Log("FAIL %s: drawn differently", equivalences[i].name);
+        failures++;
+      } else {
+        SDL_Log("ok %s", equivalences[i].name);
+      }
+    }
+    failures += test_fallbacks(&unscii16, renderer);
+    failures += test_text_view(&unscii16, renderer);
+    failures += test_ansi(&unscii8, &unscii16, renderer, budget_scale);
+  }
+
+  // the frame arena has grown to its steady state size: drawing every
+  // scenario again must not allocate
+  if (!update) {
+    const int allocations = nb_allocations;
+    for (int frame = 0; frame < 3; frame++) {
+      for (size_t i = 0; i < SDL_arraysize(scenarios); i++) {
+        DBGP_Font* font = scenarios[i].font == 8 ? &unscii8 : &unscii16;
+        draw_text(font, renderer, texts[i], colors[i]);
+      }
+      DBGP_ResetFrameArena();
+    }
+    if (nb_allocations != allocations) {
+      SDL_Log(
+          "FAIL steady state: %d allocations", nb_allocations - allocations);
+      failures++;
+    } else {
+      SDL_Log("ok steady state: no allocation");
+    }
+  }
+
+  DBGP_DestroyFont(&unscii8);
+  DBGP_DestroyFont(&unscii16);
+  DBGP_DestroyFont(&marks);
+  SDL_DestroyRenderer(renderer);
+  SDL_DestroyWindow(window);
+  SDL_Quit();
+  DBGP_SetAllocator(NULL, NULL, NULL, NULL);
+  if (failures > 0) {
+    SDL_Log("%d failure(s)", failures);
+  }
+  return failures > 0 ? 1 : 0;
+}
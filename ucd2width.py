@@ -0,0 +1,165 @@
+import argparse
+import io
+import os
+import re
+import unicodedata
+
+BEGIN_MARKER = "// BEGIN ucd2width.py"
+END_MARKER = "// END ucd2width.py"
+
+MAX_CODEPOINT = 0x10FFFF
+BLOCK_SIZE = 256
+
+# Format characters drawn as a glyph (Prepended_Concatenation_Mark)
+VISIBLE_FORMAT = {0x600, 0x601, 0x602, 0x603, 0x604, 0x605, 0x6DD, 0x70F}
+VISIBLE_FORMAT |= {0x890, 0x891, 0x8E2, 0x110BD, 0x110CD}
+
+
+def parse_ranges(path, defaults):
+    """
+    Reads a UCD file of "XXXX[..YYYY] ; value" lines (and "# @missing:"
+    lines, giving the values of unlisted codepoints) into a dict.
+    """
+    values = {}
+    missing = []
+    with open(path, encoding="UTF-8") as f:
+        for line in f:
+            if line.startswith("# @missing:"):
+                line = line[len("# @missing:") :]
+                target = missing
+            else:
+                line = line.split("#", 1)[0]
+                target = None
+            if ";" not in line:
+                continue
+            codes, value = [field.strip() for field in line.split(";")[:2]]
+            first, _, last = codes.partition("..")
+            entry = (int(first, 16), int(last or first, 16), value)
+            if target is None:
+                for cp in range(entry[0], entry[1] + 1):
+                    values[cp] = entry[2]
+            else:
+                target.append(entry)
+    # later @missing lines override the earlier (wider) ones
+    for first, last, value in missing:
+        for cp in range(first, last + 1):
+            if cp not in values:
+                defaults[cp] = value
+    return values
+
+
+def read_ucd(directory):
+    """
+    Returns the functions giving the East Asian width and general category of
+    a codepoint, from EastAsianWidth.txt and DerivedGeneralCategory.txt.
+    """
+    width_defaults = {}
+    widths = parse_ranges(
+        os.path.join(directory, "EastAsianWidth.txt"), width_defaults
+    )
+    categories = parse_ranges(
+        os.path.join(directory, "DerivedGeneralCategory.txt"), {}
+    )
+    with open(os.path.join(directory, "EastAsianWidth.txt"), encoding="UTF-8") as f:
+        version = re.search(r"EastAsianWidth-([0-9.]+)\.txt", f.readline())
+
+    def east_asian_width(cp):
+        return widths.get(cp, width_defaults.get(cp, "N"))
+
+    def category(cp):
+        return categories.get(cp, "Cn")
+
+    return east_asian_width, category, version.group(1) if version else "?"
+
+
+def get_width(cp, east_asian_width, category):
+    # Latin-1 is always drawn with one glyph per codepoint (C0 and C1 controls
+    # included), as DBGP did before widths
+    if cp < 0x300:
+        return 1
+    cat = category(cp)
+    if cat in ("Mn", "Me") or (cat == "Cf" and cp not in VISIBLE_FORMAT):
+        return 0
+    # Hangul medial vowels and final consonants combine with the leading
+    # consonant
+    if 0x1160 <= cp <= 0x11FF or 0xD7B0 <= cp <= 0xD7FF:
+        return 0
+    if east_asian_width(cp) in ("W", "F"):
+        return 2
+    return 1
+
+
+def write_table(f, version, index, blocks):
+    f.write(f"{BEGIN_MARKER} (Unicode {version}, do not edit)\n")
+    f.write(
+        "// The number of cells (0, 1 or 2) of each codepoint, in a two-stage\n"
+        "// table: width_blocks[width_index[cp >> 8]] holds the widths of the 256\n"
+        "// codepoints of the block of cp, 2 bits each.\n"
+    )
+    f.write(f"#define WIDTH_NB_BLOCKS {len(blocks)}\n")
+    f.write(f"static const Uint8 width_index[{hex(len(index))}] = {{\n")
+    for i in range(0, len(index), 12):
+        f.write("    " + ", ".join(f"0x{b:02x}" for b in index[i : i + 12]) + ",\n")
+    f.write("};\n")
+    f.write(f"static const Uint8 width_blocks[WIDTH_NB_BLOCKS][64] = {{\n")
+    for block in blocks:
+        for i in range(0, len(block), 12):
+            start = "    {" if i == 0 else "     "
+            end = "},\n" if i + 12 >= len(block) else ",\n"
+            f.write(
+                start + ", ".join(f"0x{b:02x}" for b in block[i : i + 12]) + end
+            )
+    f.write("};\n")
+    f.write(f"{END_MARKER}\n")
+
+
+if __name__ == "__main__":
+    parser = argparse.ArgumentParser(
+        description="""
+        Generates the codepoint width table of SDL_DBGP.c (the number of cells
+        each codepoint is drawn in), replacing the code between the
+        "BEGIN ucd2width.py" and "END ucd2width.py" lines of the source file.
+        Uses the Unicode Character Database files EastAsianWidth.txt and
+        DerivedGeneralCategory.txt (found at https://www.unicode.org/Public/UCD/latest/ucd/)
+        when --ucd is given, or the unicodedata module of Python otherwise.
+        """
+    )
+    parser.add_argument(
+        "--ucd",
+        help="directory of the Unicode Character Database files",
+    )
+    parser.add_argument("source_file", help="SDL_DBGP.c")
+    args = parser.parse_args()
+
+    if args.ucd:
+        east_asian_width, category, version = read_ucd(args.ucd)
+    else:
+        east_asian_width = lambda cp: unicodedata.east_asian_width(chr(cp))
+        category = lambda cp: unicodedata.category(chr(cp))
+        version = unicodedata.unidata_version
+
+    index = []
+    blocks = []
+    block_ids = {}
+    for start in range(0, MAX_CODEPOINT + 1, BLOCK_SIZE):
+        block = bytearray(BLOCK_SIZE // 4)
+        for cp in range(start, start + BLOCK_SIZE):
+            width = get_width(cp, east_asian_width, category)
+            block[(cp - start) // 4] |= width << ((cp & 3) * 2)
+        block = bytes(block)
+        if block not in block_ids:
+            block_ids[block] = len(blocks)
+            blocks.append(block)
+        index.append(block_ids[block])
+    if len(blocks) > 256:
+        raise Exception("Too many distinct blocks: {}".format(len(blocks)))
+
+    with open(args.source_file, encoding="UTF-8") as f:
+        source = f.read()
+    begin = source.index(BEGIN_MARKER)
+    end = source.index(END_MARKER, begin) + len(END_MARKER) + 1
+
+    table = io.StringIO()
+    write_table(table, version, index, blocks)
+    with open(args.source_file, "w", encoding="UTF-8", newline="\n") as f:
+        f.write(source[:begin] + table.getvalue() + source[end:])
@@ -1,14 +1,97 @@
 import argparse
 
+COMPRESSED_VERSION = 1
+MIN_MATCH = 3
+MAX_MATCH = 0x7F + MIN_MATCH
+MAX_LITERALS = 0x80
+MAX_DISTANCE = 0xFFFF
 
-def find_glyph(file, codepoint):
+# String literals longer than this are rejected by some compilers (MSVC)
+MAX_STRING_LITERAL = 65535
+
+
+def read_glyphs(file):
+    glyphs = {}
     for line in file:
-        code, glyph = line.split(":")
-        c = int(code, 16)
+        line = line.strip()
+        if ":" not in line:
+            continue
+        code, glyph = line.split(":", 1)
+        glyphs.setdefault(int(code, 16), glyph)
+    return glyphs
+
+
+def compress(data, glyph_height, nb_glyphs):
+    """
+    Compresses glyph bitmaps in the format decompressed by DBGP_CreateFont:
+    a 12-byte header, then runs of literal bytes and copies of previous bytes
+    (which deduplicate repeated rows and glyphs).
+    """
+    output = bytearray(b"DBGZ")
+    output += bytes([COMPRESSED_VERSION, glyph_height, 0, 0])
+    output += nb_glyphs.to_bytes(4, "little")
+
+    literals = bytearray()
+
+    def flush_literals():
+        for i in range(0, len(literals), MAX_LITERALS):
+            run = literals[i : i + MAX_LITERALS]
+            output.append(len(run) - 1)
+            output.extend(run)
+        literals.clear()
+
+    positions = {}  # last positions of each 3-byte sequence
+    pos = 0
+    while pos < len(data):
+        best_len, best_distance = 0, 0
+        key = bytes(data[pos : pos + MIN_MATCH])
+        for start in positions.get(key, []):
+            distance = pos - start
+            if distance > MAX_DISTANCE:
+                continue
+            length = 0
+            while (
+                length < MAX_MATCH
+                and pos + length < len(data)
+                and data[start + length] == data[pos + length]
+            ):
+                length += 1
+            if length > best_len:
+                best_len, best_distance = length, distance
 
-        if c == codepoint:
-            return glyph
-    return None
+        if best_len >= MIN_MATCH:
+            flush_literals()
+            output.append(0x80 | (best_len - MIN_MATCH))
+            output += best_distance.to_bytes(2, "little")
+            step = best_len
+        else:
+            literals.append(data[pos])
+            step = 1
+
+        for i in range(pos, pos + step):
+            chain = positions.setdefault(bytes(data[i : i + MIN_MATCH]), [])
+            chain.append(i)
+            del chain[:-32]
+        pos += step
+
+    flush_literals()
+    return bytes(output)
+
+
+def write_data(f, name, size, data, as_string):
+    if as_string:
+        # one string literal (the terminating NUL is ignored when decoding)
+        lines = []
+        for i in range(0, len(data), 18):
+            chunk = "".join("\\x{:02x}".format(b) for b in data[i : i + 18])
+            lines.append(f'    "{chunk}"')
+        f.write(f"const unsigned char {name}[{size}] =\n")
+        f.write("\n".join(lines) + ";\n")
+    else:
+        f.write(f"const unsigned char {name}[{size}] = {{\n")
+        for i in range(0, len(data), 12):
+            f.write("    " + ", ".join(map(hex, data[i : i + 12])) + ",\n")
+        f.write("};\n")
 
 
 if __name__ == "__main__":
@@ -16,6 +99,8 @@ if __name__ == "__main__":
         description="""
         Converts UNSCII .hex files into a C header file that can be used by SDL_DBGP.
         Only exports the first 256 Unicode code points by default.
+        The .hex file is read once; fonts can also be loaded at runtime with
+        DBGP_CreateFontFromHex.
         Hex files can be found here: https://github.com/viznut/unscii
         """
     )
@@ -26,6 +111,18 @@ if __name__ == "__main__":
         default=8,
         type=int,
     )
+    parser.add_argument(
+        "-n",
+        "--count",
+        help="number of code points to export, starting from 0",
+        default=256,
+        type=int,
+    )
+    parser.add_argument(
+        "--raw",
+        help="export uncompressed glyph bitmaps",
+        action="store_true",
+    )
     parser.add_argument("input_file", type=argparse.FileType("r"))
     parser.add_argument("output_file", type=argparse.FileType("w", encoding="UTF-8"))
     args = parser.parse_args()
@@ -33,35 +130,62 @@ if __name__ == "__main__":
     output_data = []
 
     with args.input_file as f:
-        for codepoint in range(256):
-            glyph = find_glyph(f, codepoint)
-            if glyph is None:
-                raise Exception("Codepoint {} not found in .hex file".format(codepoint))
-            f.seek(0)
+        glyphs = read_glyphs(f)
+
+    for codepoint in range(args.count):
+        glyph = glyphs.get(codepoint)
+        if glyph is None:
+            raise Exception("Codepoint {} not found in .hex file".format(codepoint))
 
-            for i in range(0, args.bytes * 2, 2):
-                byte = int(glyph[i : i + 2], 16)
-                output_data.append(byte)
+        for i in range(0, args.bytes * 2, 2):
+            byte = int(glyph[i : i + 2], 16)
+            output_data.append(byte)
 
+    if args.raw:
+        data = bytes(output_data)
+    else:
+        data = compress(output_data, args.bytes, args.count)
+    as_string = len(data) < MAX_STRING_LITERAL
+    size = len(data) + 1 if as_string else len(data)
+
+    name = f"DBGP_UNSCII{args.bytes}"
     with args.output_file as f:
         f.write(f"/*\n")
         f.write(f" * Raw data to use with SDL_DBGP. Font is\n")
         f.write(
             f" * [UNSCII-{args.bytes}](https://github.com/viznut/unscii), in the public domain.\n"
         )
-        f.write(f" */\n\n")
-        f.write(f"#ifndef DBGP_UNSCII{args.bytes}_H\n")
-        f.write(f"#define DBGP_UNSCII{args.bytes}_H\n\n")
-
-        f.write(f"static const unsigned int DBGP_UNSCII{args.bytes}_WIDTH = 8;\n")
+        f.write(f" *\n")
+        # sizes are the size of the array, as passed to DBGP_CreateFont
+        nul = " (with the final NUL)" if as_string else ""
+        if args.raw:
+            f.write(f" * {size} bytes{nul} of glyph bitmaps.\n")
+        else:
+            f.write(
+                f" * {size} bytes{nul}, compressed from {len(output_data)} bytes.\n"
+            )
+        f.write(f" *\n")
         f.write(
-            f"static const unsigned int DBGP_UNSCII{args.bytes}_HEIGHT = {args.bytes};\n"
+            f" * Define {name}_IMPLEMENTATION in exactly one source file before\n"
         )
-        f.write(f"static const unsigned int DBGP_UNSCII{args.bytes}_NB_GLYPHS = 256;\n")
-        f.write(
-            f"static const unsigned char DBGP_UNSCII{args.bytes}[256 * {args.bytes}] = {{"
-        )
-        f.write(", ".join(map(hex, output_data)))
-        f.write("};\n")
+        f.write(f" * including this header.\n")
+        f.write(f" */\n\n")
+        f.write(f"#ifndef {name}_H\n")
+        f.write(f"#define {name}_H\n\n")
+
+        f.write(f"static const unsigned int {name}_WIDTH = 8;\n")
+        f.write(f"static const unsigned int {name}_HEIGHT = {args.bytes};\n")
+        f.write(f"static const unsigned int {name}_NB_GLYPHS = {args.count};\n\n")
+
+        f.write(f"#ifdef __cplusplus\n")
+        f.write(f'extern "C" {{\n')
+        f.write(f"#endif\n\n")
+        f.write(f"extern const unsigned char {name}[{size}];\n\n")
+        f.write(f"#ifdef {name}_IMPLEMENTATION\n")
+        write_data(f, name, size, data, as_string)
+        f.write(f"#endif // {name}_IMPLEMENTATION\n\n")
+        f.write(f"#ifdef __cplusplus\n")
+        f.write(f"}}\n")
+        f.write(f"#endif\n")
 
-        f.write(f"\n#endif // DBGP_UNSCII{args.bytes}_H\n")
+        f.write(f"\n#endif // {name}_H\n")